@@ -0,0 +1,92 @@
+// ArrayView.h
+#pragma once
+#include <stdexcept>
+#include <cstddef>
+#include <type_traits>
+
+//     :   .
+//      ; ,    
+// (DynamicArray,  ,      ..)  
+// DynamicArray     .
+// ArrayView<const T> -  ,     ArrayView<T>
+template <class T>
+class ArrayView {
+private:
+    T* items;
+    int length;
+
+public:
+    typedef T value_type;
+    typedef T* iterator;
+
+    ArrayView() : items(nullptr), length(0) {}
+
+    ArrayView(T* items, int length) : items(items), length(length) {
+        if (length < 0 || (!items && length > 0)) {
+            throw std::invalid_argument("ArrayView: invalid buffer");
+        }
+    }
+
+    template <std::size_t N>
+    ArrayView(T (&array)[N]) : items(array), length((int)N) {}
+
+    // ArrayView<T> -> ArrayView<const T>
+    template <class U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    ArrayView(const ArrayView<U>& other) : items(other.GetData()), length(other.GetLength()) {}
+
+    int GetLength() const {
+        return length;
+    }
+
+    bool IsEmpty() const {
+        return length == 0;
+    }
+
+    T* GetData() const {
+        return items;
+    }
+
+    T& GetElem(int index) const {
+        if (index < 0 || index >= length)
+            throw std::out_of_range("Index out of range");
+        return items[index];
+    }
+
+    T& operator[](int index) const {
+        return GetElem(index);
+    }
+
+    T& GetFirstElem() const {
+        if (length == 0) throw std::out_of_range("View is empty");
+        return items[0];
+    }
+
+    T& GetLastElem() const {
+        if (length == 0) throw std::out_of_range("View is empty");
+        return items[length - 1];
+    }
+
+    iterator begin() const {
+        return items;
+    }
+
+    iterator end() const {
+        return items + length;
+    }
+
+    //  [startIndex, endIndex],   DynamicArray,   
+    ArrayView<T> GetSubsequence(int startIndex, int endIndex) const {
+        if (startIndex < 0 || endIndex >= length || startIndex > endIndex) {
+            throw std::out_of_range("Invalid subsequence indices");
+        }
+        return ArrayView<T>(items + startIndex, endIndex - startIndex + 1);
+    }
+
+    // count    start;   
+    ArrayView<T> Slice(int start, int count) const {
+        if (start < 0 || count < 0 || start > length - count) {
+            throw std::out_of_range("Invalid slice");
+        }
+        return ArrayView<T>(items + start, count);
+    }
+};
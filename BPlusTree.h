@@ -0,0 +1,655 @@
+// BPlusTree.h
+#pragma once
+
+#include "IOrderedDictionary.h"
+#include "DynamicArray.h"
+#include "Pair.h"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <climits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ,       B+-.    Pair<int, int>
+//            
+// (PACKED);         
+template <typename Key, bool Arithmetic = std::is_arithmetic<Key>::value>
+struct BPlusKey {
+    static const bool PACKED = false;
+    typedef Key Stored;
+    static const Key& encode(const Key& key) { return key; }
+};
+
+template <typename Key>
+struct BPlusKey<Key, true> {
+    static const bool PACKED = true;
+    typedef Key Stored;
+    static Key encode(Key key) { return key; }
+};
+
+// (key, value) -> key * 2^32 + (value - INT_MIN):      
+template <>
+struct BPlusKey<Pair<int, int>, false> {
+    static const bool PACKED = true;
+    typedef int64_t Stored;
+    static int64_t encode(const Pair<int, int>& key) {
+        return (int64_t)key.key * 4294967296LL + ((int64_t)key.value - INT_MIN);
+    }
+};
+
+//   keys[0..count),  key.     
+template <typename Stored>
+inline int bplusCountLess(const Stored* keys, int count, Stored key) {
+    int result = 0;
+    for (int i = 0; i < count; i++) {
+        result += keys[i] < key ? 1 : 0;
+    }
+    return result;
+}
+
+//   keys[0..count),   key
+template <typename Stored>
+inline int bplusCountNotGreater(const Stored* keys, int count, Stored key) {
+    int result = 0;
+    for (int i = 0; i < count; i++) {
+        result += key < keys[i] ? 0 : 1;
+    }
+    return result;
+}
+
+#if defined(__AVX2__)
+//  64-    4   ( SSE2   )
+inline int bplusCountLess(const int64_t* keys, int count, int64_t key) {
+    __m256i probe = _mm256_set1_epi64x(key);
+    int result = 0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(keys + i));
+        __m256i less = _mm256_cmpgt_epi64(probe, block);
+        result += _mm_popcnt_u32((unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(less)));
+    }
+    for (; i < count; i++) {
+        result += keys[i] < key ? 1 : 0;
+    }
+    return result;
+}
+
+inline int bplusCountNotGreater(const int64_t* keys, int count, int64_t key) {
+    __m256i probe = _mm256_set1_epi64x(key);
+    int greater = 0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(keys + i));
+        __m256i more = _mm256_cmpgt_epi64(block, probe);
+        greater += _mm_popcnt_u32((unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(more)));
+    }
+    for (; i < count; i++) {
+        greater += key < keys[i] ? 1 : 0;
+    }
+    return count - greater;
+}
+#endif
+
+// B+-:  ORDER   ,     ,  
+//      .   10^6   ORDER = 32
+//  4-5   ~20  AVL-.
+//  ,  ,     
+template <typename Key, typename Value, int ORDER = 32>
+class BPlusTree : public IOrderedDictionary<Key, Value> {
+    static_assert(ORDER >= 8 && ORDER % 2 == 0, "BPlusTree ORDER must be even and at least 8");
+
+private:
+    typedef BPlusKey<Key> Codec;
+    typedef typename Codec::Stored Stored;
+    typedef std::integral_constant<bool, Codec::PACKED> IsPacked;
+
+    static const int MIN_KEYS = ORDER / 2;
+    //  ,  ,   5 ,     n < 2^31  32
+    static const int MAX_DEPTH = 32;
+
+    struct Node {
+        bool leaf;
+        int count;  //  
+
+        explicit Node(bool leaf) : leaf(leaf), count(0) {}
+    };
+
+    //  children[i]    [keys[i - 1], keys[i])
+    struct Inner : Node {
+        Stored keys[ORDER];
+        Node* children[ORDER + 1];
+
+        Inner() : Node(false) {}
+    };
+
+    struct Leaf : Node {
+        Stored keys[Codec::PACKED ? ORDER : 1];  //   pairs   ( PACKED)
+        Pair<Key, Value> pairs[ORDER];
+        Leaf* next;
+        Leaf* prev;
+
+        Leaf() : Node(true), next(nullptr), prev(nullptr) {}
+    };
+
+    Node* root;
+    Leaf* head;  //   ;     ,  head  
+    int elementCount;
+
+    //      
+    static Stored leafKey(const Leaf* leaf, int i) {
+        return leafKey(leaf, i, IsPacked());
+    }
+
+    static Stored leafKey(const Leaf* leaf, int i, std::true_type) {
+        return leaf->keys[i];
+    }
+
+    static Stored leafKey(const Leaf* leaf, int i, std::false_type) {
+        return leaf->pairs[i].key;
+    }
+
+    //   (    )  src[si]  dst[di]
+    static void moveEntry(Leaf* dst, int di, Leaf* src, int si) {
+        dst->pairs[di] = std::move(src->pairs[si]);
+        copyKey(dst, di, src, si, IsPacked());
+    }
+
+    static void copyKey(Leaf* dst, int di, Leaf* src, int si, std::true_type) {
+        dst->keys[di] = src->keys[si];
+    }
+
+    static void copyKey(Leaf*, int, Leaf*, int, std::false_type) {}
+
+    static void setKey(Leaf* leaf, int i, std::true_type) {
+        leaf->keys[i] = Codec::encode(leaf->pairs[i].key);
+    }
+
+    static void setKey(Leaf*, int, std::false_type) {}
+
+    //    ,   key ( orEqual -  key)
+    static int leafPosition(const Leaf* leaf, const Key& key, bool orEqual) {
+        return leafPosition(leaf, key, orEqual, IsPacked());
+    }
+
+    static int leafPosition(const Leaf* leaf, const Key& key, bool orEqual, std::true_type) {
+        Stored probe = Codec::encode(key);
+        return orEqual
+            ? bplusCountNotGreater(leaf->keys, leaf->count, probe)
+            : bplusCountLess(leaf->keys, leaf->count, probe);
+    }
+
+    static int leafPosition(const Leaf* leaf, const Key& key, bool orEqual, std::false_type) {
+        int lo = 0;
+        int hi = leaf->count;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            bool goRight = orEqual ? !(key < leaf->pairs[mid].key) : leaf->pairs[mid].key < key;
+            if (goRight) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    //  ,     :  ,   probe
+    static int childIndex(const Inner* node, const Stored& probe) {
+        return childIndex(node, probe, IsPacked());
+    }
+
+    static int childIndex(const Inner* node, const Stored& probe, std::true_type) {
+        return bplusCountNotGreater(node->keys, node->count, probe);
+    }
+
+    static int childIndex(const Inner* node, const Stored& probe, std::false_type) {
+        int lo = 0;
+        int hi = node->count;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (probe < node->keys[mid]) {
+                hi = mid;
+            }
+            else {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    }
+
+    Leaf* findLeaf(const Key& key) const {
+        const Stored& probe = Codec::encode(key);
+        Node* node = root;
+        while (!node->leaf) {
+            const Inner* inner = static_cast<const Inner*>(node);
+            node = inner->children[childIndex(inner, probe)];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    //      -1
+    static int indexInLeaf(const Leaf* leaf, const Key& key) {
+        int pos = leafPosition(leaf, key, false);
+        return (pos < leaf->count && !(key < leaf->pairs[pos].key)) ? pos : -1;
+    }
+
+    static void insertIntoLeaf(Leaf* leaf, int pos, const Key& key, const Value& value) {
+        for (int i = leaf->count; i > pos; i--) {
+            moveEntry(leaf, i, leaf, i - 1);
+        }
+        leaf->pairs[pos] = Pair<Key, Value>(key, value);
+        setKey(leaf, pos, IsPacked());
+        leaf->count++;
+    }
+
+    static void insertIntoInner(Inner* node, int slot, const Stored& separator, Node* child) {
+        for (int i = node->count; i > slot; i--) {
+            node->keys[i] = std::move(node->keys[i - 1]);
+            node->children[i + 1] = node->children[i];
+        }
+        node->keys[slot] = separator;
+        node->children[slot + 1] = child;
+        node->count++;
+    }
+
+    //           path[0..depth)
+    // (slots -    );    ,  
+    //  ,       
+    void insertIntoParents(Inner** path, int* slots, int depth, Stored separator, Node* child) {
+        while (depth > 0) {
+            Inner* node = path[--depth];
+            int slot = slots[depth];
+            if (node->count < ORDER) {
+                insertIntoInner(node, slot, separator, child);
+                return;
+            }
+
+            Stored keys[ORDER + 1];
+            Node* children[ORDER + 2];
+            for (int i = 0, j = 0; i <= ORDER; i++) {
+                keys[i] = i == slot ? separator : std::move(node->keys[j++]);
+            }
+            for (int i = 0, j = 0; i <= ORDER + 1; i++) {
+                children[i] = i == slot + 1 ? child : node->children[j++];
+            }
+
+            const int mid = ORDER / 2;
+            Inner* right = new Inner();
+            node->count = mid;
+            for (int i = 0; i < mid; i++) {
+                node->keys[i] = std::move(keys[i]);
+            }
+            for (int i = 0; i <= mid; i++) {
+                node->children[i] = children[i];
+            }
+            right->count = ORDER - mid;
+            for (int i = 0; i < right->count; i++) {
+                right->keys[i] = std::move(keys[mid + 1 + i]);
+            }
+            for (int i = 0; i <= right->count; i++) {
+                right->children[i] = children[mid + 1 + i];
+            }
+
+            separator = std::move(keys[mid]);
+            child = right;
+        }
+
+        Inner* newRoot = new Inner();
+        newRoot->count = 1;
+        newRoot->keys[0] = separator;
+        newRoot->children[0] = root;
+        newRoot->children[1] = child;
+        root = newRoot;
+    }
+
+    //   :    ;    .
+    //       ,    
+    Pair<Value*, bool> insertEntry(const Key& key, const Value& value, bool overwrite) {
+        const Stored& probe = Codec::encode(key);
+        Inner* path[MAX_DEPTH];
+        int slots[MAX_DEPTH];
+        int depth = 0;
+        Node* node = root;
+        while (!node->leaf) {
+            Inner* inner = static_cast<Inner*>(node);
+            int slot = childIndex(inner, probe);
+            path[depth] = inner;
+            slots[depth++] = slot;
+            node = inner->children[slot];
+        }
+
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = leafPosition(leaf, key, false);
+        if (pos < leaf->count && !(key < leaf->pairs[pos].key)) {
+            if (overwrite) {
+                leaf->pairs[pos].value = value;
+            }
+            return Pair<Value*, bool>(&leaf->pairs[pos].value, false);
+        }
+
+        elementCount++;
+        if (leaf->count < ORDER) {
+            insertIntoLeaf(leaf, pos, key, value);
+            return Pair<Value*, bool>(&leaf->pairs[pos].value, true);
+        }
+
+        //      ,     
+        const int half = ORDER / 2;
+        Leaf* right = new Leaf();
+        for (int i = half; i < ORDER; i++) {
+            moveEntry(right, i - half, leaf, i);
+        }
+        right->count = ORDER - half;
+        leaf->count = half;
+        right->next = leaf->next;
+        if (right->next) {
+            right->next->prev = right;
+        }
+        right->prev = leaf;
+        leaf->next = right;
+
+        Value* inserted;
+        if (pos <= half) {
+            insertIntoLeaf(leaf, pos, key, value);
+            inserted = &leaf->pairs[pos].value;
+        }
+        else {
+            insertIntoLeaf(right, pos - half, key, value);
+            inserted = &right->pairs[pos - half].value;
+        }
+        insertIntoParents(path, slots, depth, leafKey(right, 0), right);
+        return Pair<Value*, bool>(inserted, true);
+    }
+
+    //   keys[index]   children[index + 1]
+    static void removeFromInner(Inner* node, int index) {
+        for (int i = index; i < node->count - 1; i++) {
+            node->keys[i] = std::move(node->keys[i + 1]);
+            node->children[i + 1] = node->children[i + 2];
+        }
+        node->count--;
+    }
+
+    //      MIN_KEYS        
+    static void fixLeaf(Leaf* leaf, Inner* parent, int slot) {
+        Leaf* left = slot > 0 ? static_cast<Leaf*>(parent->children[slot - 1]) : nullptr;
+        Leaf* right = slot < parent->count ? static_cast<Leaf*>(parent->children[slot + 1]) : nullptr;
+
+        if (left && left->count > MIN_KEYS) {
+            for (int i = leaf->count; i > 0; i--) {
+                moveEntry(leaf, i, leaf, i - 1);
+            }
+            moveEntry(leaf, 0, left, left->count - 1);
+            left->count--;
+            leaf->count++;
+            parent->keys[slot - 1] = leafKey(leaf, 0);
+        }
+        else if (right && right->count > MIN_KEYS) {
+            moveEntry(leaf, leaf->count, right, 0);
+            leaf->count++;
+            for (int i = 0; i < right->count - 1; i++) {
+                moveEntry(right, i, right, i + 1);
+            }
+            right->count--;
+            parent->keys[slot] = leafKey(right, 0);
+        }
+        else if (left) {
+            mergeLeaves(left, leaf);
+            removeFromInner(parent, slot - 1);
+        }
+        else {
+            mergeLeaves(leaf, right);
+            removeFromInner(parent, slot);
+        }
+    }
+
+    //          
+    static void mergeLeaves(Leaf* left, Leaf* right) {
+        for (int i = 0; i < right->count; i++) {
+            moveEntry(left, left->count + i, right, i);
+        }
+        left->count += right->count;
+        left->next = right->next;
+        if (left->next) {
+            left->next->prev = left;
+        }
+        delete right;
+    }
+
+    //     :      
+    static void fixInner(Inner* node, Inner* parent, int slot) {
+        Inner* left = slot > 0 ? static_cast<Inner*>(parent->children[slot - 1]) : nullptr;
+        Inner* right = slot < parent->count ? static_cast<Inner*>(parent->children[slot + 1]) : nullptr;
+
+        if (left && left->count > MIN_KEYS) {
+            node->children[node->count + 1] = node->children[node->count];
+            for (int i = node->count; i > 0; i--) {
+                node->keys[i] = std::move(node->keys[i - 1]);
+                node->children[i] = node->children[i - 1];
+            }
+            node->keys[0] = std::move(parent->keys[slot - 1]);
+            node->children[0] = left->children[left->count];
+            parent->keys[slot - 1] = std::move(left->keys[left->count - 1]);
+            left->count--;
+            node->count++;
+        }
+        else if (right && right->count > MIN_KEYS) {
+            node->keys[node->count] = std::move(parent->keys[slot]);
+            node->children[node->count + 1] = right->children[0];
+            node->count++;
+            parent->keys[slot] = std::move(right->keys[0]);
+            for (int i = 0; i < right->count - 1; i++) {
+                right->keys[i] = std::move(right->keys[i + 1]);
+                right->children[i] = right->children[i + 1];
+            }
+            right->children[right->count - 1] = right->children[right->count];
+            right->count--;
+        }
+        else if (left) {
+            mergeInner(left, node, parent->keys[slot - 1]);
+            removeFromInner(parent, slot - 1);
+        }
+        else {
+            mergeInner(node, right, parent->keys[slot]);
+            removeFromInner(parent, slot);
+        }
+    }
+
+    //           
+    static void mergeInner(Inner* left, Inner* right, const Stored& separator) {
+        left->keys[left->count] = separator;
+        for (int i = 0; i < right->count; i++) {
+            left->keys[left->count + 1 + i] = std::move(right->keys[i]);
+        }
+        for (int i = 0; i <= right->count; i++) {
+            left->children[left->count + 1 + i] = right->children[i];
+        }
+        left->count += right->count + 1;
+        delete right;
+    }
+
+    //   :       
+    //    ;      
+    bool removeEntry(const Key& key) {
+        const Stored& probe = Codec::encode(key);
+        Inner* path[MAX_DEPTH];
+        int slots[MAX_DEPTH];
+        int depth = 0;
+        Node* node = root;
+        while (!node->leaf) {
+            Inner* inner = static_cast<Inner*>(node);
+            int slot = childIndex(inner, probe);
+            path[depth] = inner;
+            slots[depth++] = slot;
+            node = inner->children[slot];
+        }
+
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = indexInLeaf(leaf, key);
+        if (pos < 0) {
+            return false;
+        }
+        for (int i = pos; i < leaf->count - 1; i++) {
+            moveEntry(leaf, i, leaf, i + 1);
+        }
+        leaf->count--;
+        leaf->pairs[leaf->count] = Pair<Key, Value>();
+        elementCount--;
+
+        if (depth == 0 || leaf->count >= MIN_KEYS) {
+            return true;
+        }
+        fixLeaf(leaf, path[depth - 1], slots[depth - 1]);
+        for (int d = depth - 1; d > 0 && path[d]->count < MIN_KEYS; d--) {
+            fixInner(path[d], path[d - 1], slots[d - 1]);
+        }
+
+        if (!root->leaf && root->count == 0) {
+            Inner* oldRoot = static_cast<Inner*>(root);
+            root = oldRoot->children[0];
+            delete oldRoot;
+        }
+        return true;
+    }
+
+    //    MAX_DEPTH,    
+    void destroy(Node* node) {
+        if (node->leaf) {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for (int i = 0; i <= inner->count; i++) {
+            destroy(inner->children[i]);
+        }
+        delete inner;
+    }
+
+public:
+    BPlusTree() : elementCount(0) {
+        head = new Leaf();
+        root = head;
+    }
+
+    BPlusTree(const BPlusTree&) = delete;
+    BPlusTree& operator=(const BPlusTree&) = delete;
+
+    ~BPlusTree() {
+        destroy(root);
+    }
+
+    void insert(const Key& key, const Value& value) override {
+        insertEntry(key, value, true);
+    }
+
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        return insertEntry(key, value, false);
+    }
+
+    Value* find(const Key& key) override {
+        Leaf* leaf = findLeaf(key);
+        int pos = indexInLeaf(leaf, key);
+        return pos >= 0 ? &leaf->pairs[pos].value : nullptr;
+    }
+
+    const Value* find(const Key& key) const override {
+        const Leaf* leaf = findLeaf(key);
+        int pos = indexInLeaf(leaf, key);
+        return pos >= 0 ? &leaf->pairs[pos].value : nullptr;
+    }
+
+    bool exist(const Key& key) const override {
+        return indexInLeaf(findLeaf(key), key) >= 0;
+    }
+
+    Value get(const Key& key) const override {
+        const Value* value = find(key);
+        if (!value) throw std::runtime_error("Key not found");
+        return *value;
+    }
+
+    bool remove(const Key& key) override {
+        return removeEntry(key);
+    }
+
+    //   
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + elementCount);
+        for (const Leaf* leaf = head; leaf; leaf = leaf->next) {
+            for (int i = 0; i < leaf->count; i++) {
+                arr.EmplaceBack(leaf->pairs[i]);
+            }
+        }
+    }
+
+    const Pair<Key, Value>* lowerBound(const Key& key) const override {
+        const Leaf* leaf = findLeaf(key);
+        int pos = leafPosition(leaf, key, false);
+        if (pos == leaf->count) {
+            // ,  ,  ,   -    
+            leaf = leaf->next;
+            pos = 0;
+        }
+        return leaf ? &leaf->pairs[pos] : nullptr;
+    }
+
+    const Pair<Key, Value>* upperBound(const Key& key) const override {
+        const Leaf* leaf = findLeaf(key);
+        int pos = leafPosition(leaf, key, true);
+        if (pos == leaf->count) {
+            leaf = leaf->next;
+            pos = 0;
+        }
+        return leaf ? &leaf->pairs[pos] : nullptr;
+    }
+
+    const Pair<Key, Value>* floor(const Key& key) const override {
+        const Leaf* leaf = findLeaf(key);
+        int pos = leafPosition(leaf, key, true);
+        if (pos > 0) {
+            return &leaf->pairs[pos - 1];
+        }
+        leaf = leaf->prev;
+        return leaf ? &leaf->pairs[leaf->count - 1] : nullptr;
+    }
+
+    //  [lo, hi):      >= lo,    
+    template <typename Visitor>
+    void forEachInRange(const Key& lo, const Key& hi, Visitor visit) const {
+        const Leaf* leaf = findLeaf(lo);
+        int pos = leafPosition(leaf, lo, false);
+        while (leaf) {
+            for (; pos < leaf->count; pos++) {
+                if (!(leaf->pairs[pos].key < hi)) {
+                    return;
+                }
+                visit(leaf->pairs[pos]);
+            }
+            leaf = leaf->next;
+            pos = 0;
+        }
+    }
+
+    void visitRange(const Key& lo, const Key& hi, typename IOrderedDictionary<Key, Value>::RangeVisitor visitor,
+        void* context) const override {
+        forEachInRange(lo, hi, [visitor, context](const Pair<Key, Value>& pair) { visitor(pair, context); });
+    }
+
+    int size() const {
+        return elementCount;
+    }
+
+    //   (1     )
+    int height() const {
+        int levels = 1;
+        for (const Node* node = root; !node->leaf; node = static_cast<const Inner*>(node)->children[0]) {
+            levels++;
+        }
+        return levels;
+    }
+};
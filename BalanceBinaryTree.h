@@ -1,11 +1,16 @@
 #pragma once
 #include "IDictionary.h"
+#include "IOrderedDictionary.h"
 #include "DynamicArray.h"
 #include "Pair.h"
+#include "TreeAllocator.h"
 #include <stdexcept>
+#include <type_traits>
+#include <future>
+#include <thread>
 
-//  
-template <typename Key, typename Value>
+//  .  Counted       
+template <typename Key, typename Value, bool Counted = false>
 struct TreeNode {
     Pair<Key, Value> pair;
     TreeNode* left;
@@ -17,27 +22,66 @@ struct TreeNode {
 };
 
 template <typename Key, typename Value>
-class BalanceBinaryTree : public IDictionary<Key, Value> {
+struct TreeNode<Key, Value, true> {
+    Pair<Key, Value> pair;
+    TreeNode* left;
+    TreeNode* right;
+    int height;
+    int count;  //   
+
+    TreeNode(const Key& k, const Value& v)
+        : pair(k, v), left(nullptr), right(nullptr), height(1), count(1) {}
+};
+
+// AVL-. Allocator -    (. TreeAllocator.h):
+// NewDeleteAllocator    NodePool.
+// OrderStatistics -     select, rank  countInRange  O(log n)
+template <typename Key, typename Value, template <typename> class Allocator = NewDeleteAllocator,
+    bool OrderStatistics = false>
+class BalanceBinaryTree : public IOrderedDictionary<Key, Value> {
 private:
-    TreeNode<Key, Value>* root;
+    typedef TreeNode<Key, Value, OrderStatistics> Node;
+    typedef std::integral_constant<bool, OrderStatistics> Counted;
+
+    Node* root;
+    Allocator<Node> allocator;
+    int nodeCount;
 
-    int getHeight(TreeNode<Key, Value>* node) const {
+    static int getHeight(const Node* node) {
         return node ? node->height : 0;
     }
 
-    int getBalanceFactor(TreeNode<Key, Value>* node) const {
+    int getBalanceFactor(Node* node) const {
         return getHeight(node->left) - getHeight(node->right);
     }
 
-    void updateHeight(TreeNode<Key, Value>* node) {
+    static int getCount(const Node* node) {
+        return node ? node->count : 0;
+    }
+
+    //    (    OrderStatistics)  
+    void updateHeight(Node* node) {
         int hl = getHeight(node->left);
         int hr = getHeight(node->right);
         node->height = (hl > hr ? hl : hr) + 1;
+        updateCount(node, Counted());
     }
 
-    TreeNode<Key, Value>* rotateRight(TreeNode<Key, Value>* y) {
-        TreeNode<Key, Value>* x = y->left;
-        TreeNode<Key, Value>* T2 = x->right;
+    static void updateCount(Node* node, std::true_type) {
+        node->count = getCount(node->left) + getCount(node->right) + 1;
+    }
+
+    static void updateCount(Node*, std::false_type) {}
+
+    static void adjustCount(Node* node, int delta, std::true_type) {
+        node->count += delta;
+    }
+
+    static void adjustCount(Node*, int, std::false_type) {}
+
+    Node* rotateRight(Node* y) {
+        Node* x = y->left;
+        Node* T2 = x->right;
 
         x->right = y;
         y->left = T2;
@@ -48,9 +92,9 @@ private:
         return x;
     }
 
-    TreeNode<Key, Value>* rotateLeft(TreeNode<Key, Value>* x) {
-        TreeNode<Key, Value>* y = x->right;
-        TreeNode<Key, Value>* T2 = y->left;
+    Node* rotateLeft(Node* x) {
+        Node* y = x->right;
+        Node* T2 = y->left;
 
         y->left = x;
         x->right = T2;
@@ -61,175 +105,813 @@ private:
         return y;
     }
 
-    TreeNode<Key, Value>* insertNode(TreeNode<Key, Value>* node, const Key& key, const Value& value) {
-        if (!node) return new TreeNode<Key, Value>(key, value);
+    //  AVL-   1.44 * log2(n + 2),  n < 2^31   64
+    static const int MAX_HEIGHT = 64;
 
-        if (key < node->pair.key) {
-            node->left = insertNode(node->left, key, value);
+    //        ;
+    //    
+    Node* rebalance(Node* node) {
+        updateHeight(node);
+        int balance = getBalanceFactor(node);
+        if (balance > 1) {
+            // LR   LL
+            if (getBalanceFactor(node->left) < 0) {
+                node->left = rotateLeft(node->left);
+            }
+            return rotateRight(node);
+        }
+        if (balance < -1) {
+            // RL   RR
+            if (getBalanceFactor(node->right) > 0) {
+                node->right = rotateRight(node->right);
+            }
+            return rotateLeft(node);
         }
-        else if (key > node->pair.key) {
-            node->right = insertNode(node->right, key, value);
+        return node;
+    }
+
+    //   oldChild  parent (,  parent == nullptr)  newChild
+    void replaceChild(Node* parent, Node* oldChild, Node* newChild) {
+        if (!parent) {
+            root = newChild;
+        }
+        else if (parent->left == oldChild) {
+            parent->left = newChild;
         }
         else {
-            node->pair.value = value;
-            return node;
+            parent->right = newChild;
         }
+    }
 
-        updateHeight(node);
+    //    path[0..depth)          .
+    //     ,    ;  OrderStatistics
+    //      delta (+1  , -1  )
+    //    
+    void rebalancePath(Node** path, int depth, int delta) {
+        for (int i = depth - 1; i >= 0; i--) {
+            Node* node = path[i];
+            int oldHeight = node->height;
+            Node* balanced = rebalance(node);
+            if (balanced != node) {
+                replaceChild(i > 0 ? path[i - 1] : nullptr, node, balanced);
+            }
+            if (balanced->height == oldHeight) {
+                for (int j = i - 1; j >= 0; j--) {
+                    adjustCount(path[j], delta, Counted());
+                }
+                break;
+            }
+        }
+    }
 
-        int balance = getBalanceFactor(node);
+    //   :         .
+    //       ,    ;
+    //  overwrite = false     
+    Pair<Value*, bool> insertNode(const Key& key, const Value& value, bool overwrite) {
+        Node* path[MAX_HEIGHT];
+        int depth = 0;
+        Node* node = root;
+        while (node) {
+            if (key < node->pair.key) {
+                path[depth++] = node;
+                node = node->left;
+            }
+            else if (key > node->pair.key) {
+                path[depth++] = node;
+                node = node->right;
+            }
+            else {
+                if (overwrite) {
+                    node->pair.value = value;
+                }
+                return Pair<Value*, bool>(&node->pair.value, false);
+            }
+        }
 
-        // LL
-        if (balance > 1 && key < node->left->pair.key)
-            return rotateRight(node);
+        Node* created = allocator.create(key, value);
+        nodeCount++;
+        if (depth == 0) {
+            root = created;
+        }
+        else if (key < path[depth - 1]->pair.key) {
+            path[depth - 1]->left = created;
+        }
+        else {
+            path[depth - 1]->right = created;
+        }
+        rebalancePath(path, depth, 1);
+        return Pair<Value*, bool>(&created->pair.value, true);
+    }
 
-        // RR
-        if (balance < -1 && key > node->right->pair.key)
-            return rotateLeft(node);
+    Node* findNode(const Key& key) const {
+        Node* node = root;
+        while (node) {
+            if (key < node->pair.key) node = node->left;
+            else if (key > node->pair.key) node = node->right;
+            else return node;
+        }
+        return nullptr;
+    }
 
-        // LR
-        if (balance > 1 && key > node->left->pair.key) {
-            node->left = rotateLeft(node->left);
-            return rotateRight(node);
+    //   .        
+    // (  ),    ,     
+    bool removeNode(const Key& key) {
+        Node* path[MAX_HEIGHT];
+        int depth = 0;
+        Node* node = root;
+        while (node) {
+            if (key < node->pair.key) {
+                path[depth++] = node;
+                node = node->left;
+            }
+            else if (key > node->pair.key) {
+                path[depth++] = node;
+                node = node->right;
+            }
+            else {
+                break;
+            }
+        }
+        if (!node) {
+            return false;
         }
 
-        // RL
-        if (balance < -1 && key < node->right->pair.key) {
-            node->right = rotateRight(node->right);
-            return rotateLeft(node);
+        if (node->left && node->right) {
+            path[depth++] = node;
+            Node* successor = node->right;
+            while (successor->left) {
+                path[depth++] = successor;
+                successor = successor->left;
+            }
+            node->pair = successor->pair;
+            node = successor;
+        }
+
+        Node* child = node->left ? node->left : node->right;
+        replaceChild(depth > 0 ? path[depth - 1] : nullptr, node, child);
+        allocator.destroy(node);
+        nodeCount--;
+        rebalancePath(path, depth, -1);
+        return true;
+    }
+
+    //     
+    void fillArray(Node* node, DynamicArray<Pair<Key, Value>>& arr) const {
+        Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        while (node || depth > 0) {
+            while (node) {
+                stack[depth++] = node;
+                node = node->left;
+            }
+            node = stack[--depth];
+            arr.EmplaceBack(node->pair);
+            node = node->right;
+        }
+    }
+
+    //     
+    void collectNodes(Node* node, DynamicArray<Node*>& nodes) const {
+        Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        while (node || depth > 0) {
+            while (node) {
+                stack[depth++] = node;
+                node = node->left;
+            }
+            node = stack[--depth];
+            nodes.Append(node);
+            node = node->right;
         }
+    }
 
+    //       nodes[lo, hi);
+    //     .   - log2(n)
+    Node* linkBalanced(const DynamicArray<Node*>& nodes, int lo, int hi) {
+        if (lo >= hi) {
+            return nullptr;
+        }
+        int mid = lo + (hi - lo) / 2;
+        Node* node = nodes.GetElem(mid);
+        node->left = linkBalanced(nodes, lo, mid);
+        node->right = linkBalanced(nodes, mid + 1, hi);
+        updateHeight(node);
         return node;
     }
 
-    bool existNode(TreeNode<Key, Value>* node, const Key& key) const {
-        if (!node) return false;
-        if (key < node->pair.key) return existNode(node->left, key);
-        else if (key > node->pair.key) return existNode(node->right, key);
-        else return true; // key == node->pair.key
+    static bool isStrictlySorted(ArrayView<const Pair<Key, Value>> pairs) {
+        for (int i = 1; i < pairs.GetLength(); i++) {
+            if (!(pairs.GetElem(i - 1).key < pairs.GetElem(i).key)) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    Value getNode(TreeNode<Key, Value>* node, const Key& key) const {
-        if (!node) throw std::runtime_error("Key not found");
-        if (key < node->pair.key) return getNode(node->left, key);
-        else if (key > node->pair.key) return getNode(node->right, key);
-        else return node->pair.value; // key == node->pair.key
+    //           O(n + m).
+    //         , 
+    //      (   )
+    void mergeSortedPairs(ArrayView<const Pair<Key, Value>> sorted) {
+        DynamicArray<Node*> existing(nodeCount);
+        collectNodes(root, existing);
+        DynamicArray<Node*> merged(nodeCount + sorted.GetLength());
+
+        try {
+            int i = 0;
+            int j = 0;
+            while (i < existing.GetLength() || j < sorted.GetLength()) {
+                if (j == sorted.GetLength() ||
+                    (i < existing.GetLength() && existing.GetElem(i)->pair.key < sorted.GetElem(j).key)) {
+                    merged.Append(existing.GetElem(i++));
+                }
+                else if (i == existing.GetLength() || sorted.GetElem(j).key < existing.GetElem(i)->pair.key) {
+                    merged.Append(nullptr);
+                    merged.GetLastElem() = allocator.create(sorted.GetElem(j).key, sorted.GetElem(j).value);
+                    j++;
+                }
+                else {
+                    existing.GetElem(i)->pair.value = sorted.GetElem(j++).value;
+                    merged.Append(existing.GetElem(i++));
+                }
+            }
+        }
+        catch (...) {
+            //     merged    ,    existing;  - 
+            for (int i = 0, j = 0; i < merged.GetLength(); i++) {
+                if (j < existing.GetLength() && merged.GetElem(i) == existing.GetElem(j)) {
+                    j++;
+                }
+                else if (merged.GetElem(i)) {
+                    allocator.destroy(merged.GetElem(i));
+                }
+            }
+            throw;
+        }
+
+        nodeCount = merged.GetLength();
+        root = linkBalanced(merged, 0, nodeCount);
     }
 
-    TreeNode<Key, Value>* findMin(TreeNode<Key, Value>* node) const {
-        return node->left ? findMin(node->left) : node;
+    //   other,      O(n)
+    void copyFrom(const BalanceBinaryTree& other) {
+        DynamicArray<Node*> source(other.nodeCount);
+        other.collectNodes(other.root, source);
+        DynamicArray<Node*> copies(other.nodeCount);
+        try {
+            for (int i = 0; i < source.GetLength(); i++) {
+                copies.Append(nullptr);
+                copies.GetLastElem() = allocator.create(source.GetElem(i)->pair.key, source.GetElem(i)->pair.value);
+            }
+        }
+        catch (...) {
+            for (int i = 0; i < copies.GetLength(); i++) {
+                if (copies.GetElem(i)) {
+                    allocator.destroy(copies.GetElem(i));
+                }
+            }
+            throw;
+        }
+        nodeCount = copies.GetLength();
+        root = linkBalanced(copies, 0, nodeCount);
     }
 
-    TreeNode<Key, Value>* removeMin(TreeNode<Key, Value>* node) {
-        if (!node->left) return node->right;
-        node->left = removeMin(node->left);
-        updateHeight(node);
-        return node;
+    //     :     ,
+    //         
+    void clear(Node* node) {
+        while (node) {
+            if (node->left) {
+                Node* left = node->left;
+                node->left = left->right;
+                left->right = node;
+                node = left;
+            }
+            else {
+                Node* right = node->right;
+                allocator.destroy(node);
+                node = right;
+            }
+        }
     }
 
-    TreeNode<Key, Value>* removeNode(TreeNode<Key, Value>* node, const Key& key, bool& success) {
-        if (!node) {
-            success = false;
-            return nullptr;
+    //      join  split (Blelloch, Ferizovic, Sun,
+    // "Just Join for Parallel Ordered Sets").       
+
+    //   left < middle < right  O(|h(left) - h(right)| + 1): middle  
+    //           ,
+    //  -    ,   
+    Node* join(Node* left, Node* middle, Node* right) {
+        int hl = getHeight(left);
+        int hr = getHeight(right);
+        Node* path[MAX_HEIGHT];
+        int depth = 0;
+        if (hl > hr + 1) {
+            Node* node = left;
+            while (getHeight(node) > hr + 1) {
+                path[depth++] = node;
+                node = node->right;
+            }
+            middle->left = node;
+            middle->right = right;
+            updateHeight(middle);
+            path[depth - 1]->right = middle;
+            for (int i = depth - 1; i >= 0; i--) {
+                Node* balanced = rebalance(path[i]);
+                if (i > 0) path[i - 1]->right = balanced;
+                else left = balanced;
+            }
+            return left;
         }
+        if (hr > hl + 1) {
+            Node* node = right;
+            while (getHeight(node) > hl + 1) {
+                path[depth++] = node;
+                node = node->left;
+            }
+            middle->left = left;
+            middle->right = node;
+            updateHeight(middle);
+            path[depth - 1]->left = middle;
+            for (int i = depth - 1; i >= 0; i--) {
+                Node* balanced = rebalance(path[i]);
+                if (i > 0) path[i - 1]->left = balanced;
+                else right = balanced;
+            }
+            return right;
+        }
+        middle->left = left;
+        middle->right = right;
+        updateHeight(middle);
+        return middle;
+    }
 
+    //   key: left -   key, right - , found -   key
+    // ()  nullptr
+    void split(Node* node, const Key& key, Node*& left, Node*& found, Node*& right) {
+        if (!node) {
+            left = found = right = nullptr;
+            return;
+        }
         if (key < node->pair.key) {
-            node->left = removeNode(node->left, key, success);
+            Node* rest;
+            split(node->left, key, left, found, rest);
+            right = join(rest, node, node->right);
         }
-        else if (key > node->pair.key) {
-            node->right = removeNode(node->right, key, success);
+        else if (node->pair.key < key) {
+            Node* rest;
+            split(node->right, key, rest, found, right);
+            left = join(node->left, node, rest);
         }
         else {
-            //  
-            success = true;
-            TreeNode<Key, Value>* left = node->left;
-            TreeNode<Key, Value>* right = node->right;
-            delete node;
+            left = node->left;
+            right = node->right;
+            node->left = node->right = nullptr;
+            updateHeight(node);
+            found = node;
+        }
+    }
 
-            if (!right) return left;
+    //     
+    void splitLast(Node* node, Node*& rest, Node*& last) {
+        if (!node->right) {
+            rest = node->left;
+            node->left = nullptr;
+            updateHeight(node);
+            last = node;
+            return;
+        }
+        Node* right;
+        splitLast(node->right, right, last);
+        rest = join(node->left, node, right);
+    }
 
-            TreeNode<Key, Value>* minNode = findMin(right);
-            minNode->right = removeMin(right);
-            minNode->left = left;
-            updateHeight(minNode);
+    //   left < right   
+    Node* join2(Node* left, Node* right) {
+        if (!left) {
+            return right;
+        }
+        Node* rest;
+        Node* last;
+        splitLast(left, rest, last);
+        return join(rest, last, right);
+    }
 
-            // 
-            int balance = getBalanceFactor(minNode);
-            if (balance > 1 && getBalanceFactor(minNode->left) >= 0)
-                return rotateRight(minNode);
-            if (balance > 1 && getBalanceFactor(minNode->left) < 0) {
-                minNode->left = rotateLeft(minNode->left);
-                return rotateRight(minNode);
-            }
-            if (balance < -1 && getBalanceFactor(minNode->right) <= 0)
-                return rotateLeft(minNode);
-            if (balance < -1 && getBalanceFactor(minNode->right) > 0) {
-                minNode->right = rotateRight(minNode->right);
-                return rotateLeft(minNode);
-            }
+    //        
+    Node* cloneSubtree(const Node* node, int& created) {
+        if (!node) {
+            return nullptr;
+        }
+        Node* copy = allocator.create(node->pair.key, node->pair.value);
+        created++;
+        copy->left = cloneSubtree(node->left, created);
+        copy->right = cloneSubtree(node->right, created);
+        updateHeight(copy);
+        return copy;
+    }
+
+    //    ,       ,
+    //  other   ~2^PARALLEL_MIN_HEIGHT      forks
+    static const int PARALLEL_MIN_HEIGHT = 14;
+
+    static bool runParallel(const Node* theirs, int forks) {
+        return Allocator<Node>::THREAD_SAFE && forks > 0 && getHeight(theirs) >= PARALLEL_MIN_HEIGHT;
+    }
 
-            return minNode;
+    //     : 2^forks   
+    static int availableForks() {
+        int forks = 0;
+        for (unsigned cores = std::thread::hardware_concurrency(); cores > 1; cores >>= 1) {
+            forks++;
         }
+        return forks;
+    }
 
-        updateHeight(node);
+    //    theirs:      , 
+    //      join.  O(m log(n/m + 1)),
+    //  m -  theirs. delta -      
+    template <typename MergeFunc>
+    Node* unionNodes(Node* mine, const Node* theirs, MergeFunc& merge, int forks, int& delta) {
+        if (!theirs) {
+            return mine;
+        }
+        if (!mine) {
+            return cloneSubtree(theirs, delta);
+        }
 
-        int balance = getBalanceFactor(node);
-        if (balance > 1 && getBalanceFactor(node->left) >= 0)
-            return rotateRight(node);
-        if (balance > 1 && getBalanceFactor(node->left) < 0) {
-            node->left = rotateLeft(node->left);
-            return rotateRight(node);
+        Node* left;
+        Node* found;
+        Node* right;
+        split(mine, theirs->pair.key, left, found, right);
+        if (runParallel(theirs, forks)) {
+            int rightDelta = 0;
+            std::future<Node*> rightTask = std::async(std::launch::async, [&]() {
+                return unionNodes(right, theirs->right, merge, forks - 1, rightDelta);
+            });
+            left = unionNodes(left, theirs->left, merge, forks - 1, delta);
+            right = rightTask.get();
+            delta += rightDelta;
         }
-        if (balance < -1 && getBalanceFactor(node->right) <= 0)
-            return rotateLeft(node);
-        if (balance < -1 && getBalanceFactor(node->right) > 0) {
-            node->right = rotateRight(node->right);
-            return rotateLeft(node);
+        else {
+            left = unionNodes(left, theirs->left, merge, 0, delta);
+            right = unionNodes(right, theirs->right, merge, 0, delta);
         }
 
-        return node;
+        if (found) {
+            found->pair.value = merge(found->pair.value, theirs->pair.value);
+        }
+        else {
+            found = allocator.create(theirs->pair.key, theirs->pair.value);
+            delta++;
+        }
+        return join(left, found, right);
     }
 
-    void fillArray(TreeNode<Key, Value>* node, DynamicArray<Pair<Key, Value>>& arr) const {
-        if (!node) return;
-        fillArray(node->left, arr);
-        arr.Append(node->pair);
-        fillArray(node->right, arr);
+    template <typename MergeFunc>
+    Node* intersectNodes(Node* mine, const Node* theirs, MergeFunc& merge, int forks, int& delta) {
+        if (!mine) {
+            return nullptr;
+        }
+        if (!theirs) {
+            delta -= countNodes(mine);
+            clear(mine);
+            return nullptr;
+        }
+
+        Node* left;
+        Node* found;
+        Node* right;
+        split(mine, theirs->pair.key, left, found, right);
+        if (runParallel(theirs, forks)) {
+            int rightDelta = 0;
+            std::future<Node*> rightTask = std::async(std::launch::async, [&]() {
+                return intersectNodes(right, theirs->right, merge, forks - 1, rightDelta);
+            });
+            left = intersectNodes(left, theirs->left, merge, forks - 1, delta);
+            right = rightTask.get();
+            delta += rightDelta;
+        }
+        else {
+            left = intersectNodes(left, theirs->left, merge, 0, delta);
+            right = intersectNodes(right, theirs->right, merge, 0, delta);
+        }
+
+        if (found) {
+            found->pair.value = merge(found->pair.value, theirs->pair.value);
+            return join(left, found, right);
+        }
+        return join2(left, right);
     }
 
-void clear(TreeNode<Key, Value>* node) {
-    if (!node) return;
-    clear(node->left);
-    clear(node->right);
-    delete node;
-}
+    Node* subtractNodes(Node* mine, const Node* theirs, int forks, int& delta) {
+        if (!mine || !theirs) {
+            return mine;
+        }
+
+        Node* left;
+        Node* found;
+        Node* right;
+        split(mine, theirs->pair.key, left, found, right);
+        if (found) {
+            allocator.destroy(found);
+            delta--;
+        }
+        if (runParallel(theirs, forks)) {
+            int rightDelta = 0;
+            std::future<Node*> rightTask = std::async(std::launch::async, [&]() {
+                return subtractNodes(right, theirs->right, forks - 1, rightDelta);
+            });
+            left = subtractNodes(left, theirs->left, forks - 1, delta);
+            right = rightTask.get();
+            delta += rightDelta;
+        }
+        else {
+            left = subtractNodes(left, theirs->left, 0, delta);
+            right = subtractNodes(right, theirs->right, 0, delta);
+        }
+        return join2(left, right);
+    }
+
+    static int countNodes(const Node* node) {
+        const Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        int count = 0;
+        while (node || depth > 0) {
+            while (node) {
+                stack[depth++] = node;
+                node = node->left;
+            }
+            node = stack[--depth];
+            count++;
+            node = node->right;
+        }
+        return count;
+    }
 
 public:
-    BalanceBinaryTree() : root(nullptr) {}
+    BalanceBinaryTree() : root(nullptr), nodeCount(0) {}
+
+    //   ,      ,  O(n)
+    //   (,  getAllPairs  )
+    explicit BalanceBinaryTree(ArrayView<const Pair<Key, Value>> sorted) : root(nullptr), nodeCount(0) {
+        mergeSorted(sorted);
+    }
+
+    BalanceBinaryTree(const BalanceBinaryTree& other) : root(nullptr), nodeCount(0) {
+        copyFrom(other);
+    }
+
+    BalanceBinaryTree& operator=(const BalanceBinaryTree& other) {
+        if (this != &other) {
+            clear(root);
+            root = nullptr;
+            nodeCount = 0;
+            copyFrom(other);
+        }
+        return *this;
+    }
 
     ~BalanceBinaryTree() {
-        clear(root);
+        //       ,   
+        if (Allocator<Node>::RELEASES_ALL) {
+            allocator.releaseAll();
+        }
+        else {
+            clear(root);
+        }
     }
 
     void insert(const Key& key, const Value& value) override {
-        root = insertNode(root, key, value);
+        insertNode(key, value, true);
+    }
+
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        return insertNode(key, value, false);
+    }
+
+    Value* find(const Key& key) override {
+        Node* node = findNode(key);
+        return node ? &node->pair.value : nullptr;
+    }
+
+    const Value* find(const Key& key) const override {
+        const Node* node = findNode(key);
+        return node ? &node->pair.value : nullptr;
     }
 
     bool exist(const Key& key) const override {
-        return existNode(root, key);
+        return findNode(key) != nullptr;
     }
 
     Value get(const Key& key) const override {
-        return getNode(root, key);
+        const Node* node = findNode(key);
+        if (!node) throw std::runtime_error("Key not found");
+        return node->pair.value;
     }
 
     bool remove(const Key& key) override {
-        bool success = false;
-        root = removeNode(root, key, success);
-        return success;
+        return removeNode(key);
     }
 
     void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + nodeCount);
         fillArray(root, arr);
     }
+
+    //   ,      ,  O(n + m);
+    //    ,   insert
+    void mergeSorted(ArrayView<const Pair<Key, Value>> sorted) {
+        if (!isStrictlySorted(sorted)) {
+            throw std::invalid_argument("Pairs must be sorted by key without duplicates");
+        }
+        if (sorted.GetLength() > 0) {
+            mergeSortedPairs(sorted);
+        }
+    }
+
+    //     1/16   ,  -  
+    void insertBatch(ArrayView<const Pair<Key, Value>> pairs) override {
+        if (pairs.GetLength() > 0 && pairs.GetLength() >= nodeCount / 16 && isStrictlySorted(pairs)) {
+            mergeSortedPairs(pairs);
+            return;
+        }
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            insertNode(pairs.GetElem(i).key, pairs.GetElem(i).value, true);
+        }
+    }
+
+    int size() const {
+        return nodeCount;
+    }
+
+    //   other:  other  ,    
+    //  merge(,  other). other  .    
+    //   ( Allocator::THREAD_SAFE),  merge  
+    //      
+    template <typename MergeFunc>
+    void unionWith(const BalanceBinaryTree& other, MergeFunc merge) {
+        if (this == &other) {
+            BalanceBinaryTree copy(other);
+            unionWith(copy, merge);
+            return;
+        }
+        int delta = 0;
+        root = unionNodes(root, other.root, merge, availableForks(), delta);
+        nodeCount += delta;
+    }
+
+    //   other:       merge(,  other)
+    template <typename MergeFunc>
+    void intersectWith(const BalanceBinaryTree& other, MergeFunc merge) {
+        if (this == &other) {
+            BalanceBinaryTree copy(other);
+            intersectWith(copy, merge);
+            return;
+        }
+        int delta = 0;
+        root = intersectNodes(root, other.root, merge, availableForks(), delta);
+        nodeCount += delta;
+    }
+
+    // :   ,    other
+    void subtract(const BalanceBinaryTree& other) {
+        if (this == &other) {
+            clear(root);
+            root = nullptr;
+            nodeCount = 0;
+            return;
+        }
+        int delta = 0;
+        root = subtractNodes(root, other.root, availableForks(), delta);
+        nodeCount += delta;
+    }
+
+    //   k-    (k  )
+    const Pair<Key, Value>& select(int k) const {
+        static_assert(OrderStatistics, "select requires OrderStatistics = true");
+        if (k < 0 || k >= nodeCount) {
+            throw std::out_of_range("Index out of range");
+        }
+        const Node* node = root;
+        while (true) {
+            int leftCount = getCount(node->left);
+            if (k < leftCount) {
+                node = node->left;
+            }
+            else if (k == leftCount) {
+                return node->pair;
+            }
+            else {
+                k -= leftCount + 1;
+                node = node->right;
+            }
+        }
+    }
+
+    //  ,  key
+    int rank(const Key& key) const {
+        static_assert(OrderStatistics, "rank requires OrderStatistics = true");
+        int result = 0;
+        const Node* node = root;
+        while (node) {
+            if (node->pair.key < key) {
+                result += getCount(node->left) + 1;
+                node = node->right;
+            }
+            else {
+                node = node->left;
+            }
+        }
+        return result;
+    }
+
+    //    [lo, hi)
+    int countInRange(const Key& lo, const Key& hi) const {
+        return lo < hi ? rank(hi) - rank(lo) : 0;
+    }
+
+    //     >= key
+    const Pair<Key, Value>* lowerBound(const Key& key) const override {
+        const Node* node = root;
+        const Node* result = nullptr;
+        while (node) {
+            if (node->pair.key < key) {
+                node = node->right;
+            }
+            else {
+                result = node;
+                node = node->left;
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    //     > key
+    const Pair<Key, Value>* upperBound(const Key& key) const override {
+        const Node* node = root;
+        const Node* result = nullptr;
+        while (node) {
+            if (key < node->pair.key) {
+                result = node;
+                node = node->left;
+            }
+            else {
+                node = node->right;
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    //     <= key
+    const Pair<Key, Value>* floor(const Key& key) const override {
+        const Node* node = root;
+        const Node* result = nullptr;
+        while (node) {
+            if (key < node->pair.key) {
+                node = node->left;
+            }
+            else {
+                result = node;
+                node = node->right;
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    //  [lo, hi)  O(log n + k):     >= lo   
+    //       >= hi
+    template <typename Visitor>
+    void forEachInRange(const Key& lo, const Key& hi, Visitor visit) const {
+        const Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        const Node* node = root;
+        while (node) {
+            if (node->pair.key < lo) {
+                node = node->right;
+            }
+            else {
+                stack[depth++] = node;
+                node = node->left;
+            }
+        }
+
+        while (depth > 0) {
+            node = stack[--depth];
+            if (!(node->pair.key < hi)) {
+                return;
+            }
+            visit(node->pair);
+            for (node = node->right; node; node = node->left) {
+                stack[depth++] = node;
+            }
+        }
+    }
+
+    void visitRange(const Key& lo, const Key& hi, typename IOrderedDictionary<Key, Value>::RangeVisitor visitor,
+        void* context) const override {
+        forEachInRange(lo, hi, [visitor, context](const Pair<Key, Value>& pair) { visitor(pair, context); });
+    }
+
+    //   (0  )
+    int height() const {
+        return getHeight(root);
+    }
 };
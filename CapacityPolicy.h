@@ -0,0 +1,152 @@
+// CapacityPolicy.h
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+//   -   .
+//    ,      ,
+//      ,    
+//     .
+//
+//  :
+//   void reset(int minCapacity)               -     minCapacity
+//   int size() const                          -  
+//   size_t home(size_t hash) const            -  
+//   size_t step(size_t hash) const            -  ,    size()
+//   size_t next(size_t index, size_t step) const -  
+
+namespace CapacityDetail {
+    //  64-   32 
+    inline uint32_t fold(size_t hash) {
+        uint64_t h = (uint64_t)hash;
+        return (uint32_t)(h ^ (h >> 32));
+    }
+
+    //  64   a * b
+    inline uint64_t mulHigh(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return __umulh(a, b);
+#else
+        uint64_t aLow = (uint32_t)a, aHigh = a >> 32;
+        uint64_t bLow = (uint32_t)b, bHigh = b >> 32;
+        uint64_t lowLow = aLow * bLow;
+        uint64_t highLow = aHigh * bLow;
+        uint64_t lowHigh = aLow * bHigh;
+        uint64_t cross = (lowLow >> 32) + (uint32_t)highLow + lowHigh;
+        return aHigh * bHigh + (highLow >> 32) + (cross >> 32);
+#endif
+    }
+
+    //       (Lemire, "fastmod"):
+    // a % d  32- a  d   
+    struct FastModulo {
+        uint32_t divisor;
+        uint64_t magic;
+
+        FastModulo() : divisor(1), magic(0) {}
+        explicit FastModulo(uint32_t d) : divisor(d), magic(UINT64_C(0xFFFFFFFFFFFFFFFF) / d + 1) {}
+
+        uint32_t mod(uint32_t a) const {
+            return (uint32_t)mulHigh(magic * a, divisor);
+        }
+    };
+
+    //  ,    sqrt(2) 
+    const int PRIMES[] = {
+        3, 5, 7, 11, 17, 23, 37, 47, 67, 97, 131, 181, 257, 367, 521, 727, 1031, 1451,
+        2053, 2897, 4099, 5801, 8209, 11587, 16411, 23173, 32771, 46349, 65537, 92683,
+        131101, 185369, 262147, 370759, 524309, 741457, 1048583, 1482919, 2097169,
+        2965847, 4194319, 5931649, 8388617, 11863289, 16777259, 23726569, 33554467,
+        47453149, 67108879, 94906297, 134217757, 189812533, 268435459, 379625083,
+        536870923, 759250133, 1073741827, 1518500279, 2147483647
+    };
+    const int PRIME_COUNT = sizeof(PRIMES) / sizeof(PRIMES[0]);
+}
+
+//       .
+//    1  size() - 1   ;    FastModulo
+struct PrimeCapacity {
+    CapacityDetail::FastModulo capacityMod; //   size()
+    CapacityDetail::FastModulo stepMod;     //   size() - 1
+
+    PrimeCapacity() {
+        reset(1);
+    }
+
+    void reset(int minCapacity) {
+        int i = 0;
+        while (i < CapacityDetail::PRIME_COUNT - 1 && CapacityDetail::PRIMES[i] < minCapacity) {
+            i++;
+        }
+        if (CapacityDetail::PRIMES[i] < minCapacity) {
+            throw std::length_error("HashTable capacity is too large.");
+        }
+        uint32_t prime = (uint32_t)CapacityDetail::PRIMES[i];
+        capacityMod = CapacityDetail::FastModulo(prime);
+        stepMod = CapacityDetail::FastModulo(prime - 1);
+    }
+
+    int size() const {
+        return (int)capacityMod.divisor;
+    }
+
+    size_t home(size_t hash) const {
+        return capacityMod.mod(CapacityDetail::fold(hash));
+    }
+
+    size_t step(size_t hash) const {
+        return 1 + stepMod.mod(CapacityDetail::fold(hash) >> 1);
+    }
+
+    size_t next(size_t index, size_t step) const {
+        // step < size(),    
+        index += step;
+        return index >= capacityMod.divisor ? index - capacityMod.divisor : index;
+    }
+};
+
+//  -  :   ,
+//           
+struct PowerOfTwoCapacity {
+    size_t mask;
+
+    PowerOfTwoCapacity() : mask(0) {
+        reset(1);
+    }
+
+    void reset(int minCapacity) {
+        if (minCapacity > (1 << 30)) {
+            throw std::length_error("HashTable capacity is too large.");
+        }
+        size_t capacity = 8;
+        while (capacity < (size_t)minCapacity) {
+            capacity *= 2;
+        }
+        mask = capacity - 1;
+    }
+
+    int size() const {
+        return (int)(mask + 1);
+    }
+
+    size_t home(size_t hash) const {
+        return CapacityDetail::fold(hash) & mask;
+    }
+
+    size_t step(size_t hash) const {
+        uint32_t h = CapacityDetail::fold(hash);
+        return ((h >> 16) | (h << 16) | 1) & mask;
+    }
+
+    size_t next(size_t index, size_t step) const {
+        return (index + step) & mask;
+    }
+};
@@ -2,22 +2,89 @@
 #pragma once
 
 #include <functional>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 #include "Pair.h"
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+//    
+namespace HashMix {
+    //       ,    
+    const uint64_t SEED_PRIMARY = 0x9E3779B97F4A7C15ull;
+    const uint64_t SEED_SECONDARY = 0xC2B2AE3D27D4EB4Full;
+
+    //  64-  (splitmix64):        
+    inline uint64_t mix64(uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    //  64 x 64 -> 128  XOR ,   wyhash
+    inline uint64_t mum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 r = (unsigned __int128)a * b;
+        return (uint64_t)r ^ (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        uint64_t high;
+        uint64_t low = _umul128(a, b, &high);
+        return low ^ high;
+#else
+        return mix64(a ^ mix64(b));
+#endif
+    }
+
+    //   int   64- 
+    inline uint64_t pack(int first, int second) {
+        return ((uint64_t)(uint32_t)first << 32) | (uint32_t)second;
+    }
+
+    //  double; -0.0   0.0,      ==
+    inline uint64_t doubleBits(double value) {
+        if (value == 0.0) {
+            value = 0.0;
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    //   double   wyhash/xxh3
+    inline uint64_t mixDoubles(double first, double second, uint64_t seed) {
+        return mum(doubleBits(first) ^ seed, doubleBits(second) ^ 0xE7037ED1A0B428DBull) ^ seed;
+    }
+}
+
 //   -
 template <typename Key>
 struct DefaultHash {
     size_t operator()(const Key& key) const {
-        return std::hash<Key>()(key);
+        // std::hash    ,   
+        return (size_t)HashMix::mix64((uint64_t)std::hash<Key>()(key) ^ HashMix::SEED_PRIMARY);
+    }
+
+    //     
+    size_t second(const Key& key) const {
+        return (size_t)HashMix::mix64((uint64_t)std::hash<Key>()(key) ^ HashMix::SEED_SECONDARY);
     }
 };
 
-//   Pair<int, int>
+//   Pair<int, int>:     64- 
 template <>
 struct DefaultHash<Pair<int, int>> {
     size_t operator()(const Pair<int, int>& keyPair) const {
-        //      
-        return std::hash<int>()(keyPair.key) ^ (std::hash<int>()(keyPair.value) << 1);
+        return (size_t)HashMix::mix64(HashMix::pack(keyPair.key, keyPair.value) ^ HashMix::SEED_PRIMARY);
+    }
+
+    size_t second(const Pair<int, int>& keyPair) const {
+        return (size_t)HashMix::mix64(HashMix::pack(keyPair.key, keyPair.value) ^ HashMix::SEED_SECONDARY);
     }
 };
 
@@ -25,8 +92,26 @@ struct DefaultHash<Pair<int, int>> {
 template <>
 struct DefaultHash<Pair<double, double>> {
     size_t operator()(const Pair<double, double>& keyPair) const {
-        //     
-        return std::hash<double>()(keyPair.key) ^ (std::hash<double>()(keyPair.value) << 1);
+        return (size_t)HashMix::mixDoubles(keyPair.key, keyPair.value, HashMix::SEED_PRIMARY);
+    }
+
+    size_t second(const Pair<double, double>& keyPair) const {
+        return (size_t)HashMix::mixDoubles(keyPair.key, keyPair.value, HashMix::SEED_SECONDARY);
     }
 };
 
+//   :  second() -,   ,
+//    
+template <typename HashFunc, typename Key, typename = void>
+struct SecondHash {
+    static size_t get(const HashFunc&, const Key&, size_t primary) {
+        return (size_t)HashMix::mix64((uint64_t)primary ^ HashMix::SEED_SECONDARY);
+    }
+};
+
+template <typename HashFunc, typename Key>
+struct SecondHash<HashFunc, Key, decltype((void)std::declval<const HashFunc&>().second(std::declval<const Key&>()))> {
+    static size_t get(const HashFunc& hashFunc, const Key& key, size_t) {
+        return hashFunc.second(key);
+    }
+};
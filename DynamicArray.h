@@ -1,8 +1,18 @@
 #pragma once
 #include "Sequence.h"
+#include "ArrayView.h"
 #include <stdexcept>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
 #include <iostream>  //    Print   DynamicArray
 
+//    :     
+// size ,  capacity - size  .
+//       (. SmallDynamicArray): 
+// ,   ,    
 template <class T>
 class DynamicArray : public Sequence<T>
 {
@@ -10,23 +20,135 @@ private:
     T* data;
     int size;
     int capacity;
+    T* inlineData = nullptr;
+    int inlineCapacity = 0;
+
+    typedef std::integral_constant<bool, std::is_trivially_copyable<T>::value> Trivial;
+
+    static T* Allocate(int count) {
+        return count > 0 ? std::allocator<T>().allocate(count) : nullptr;
+    }
+
+    static void Deallocate(T* items, int count) {
+        if (items) {
+            std::allocator<T>().deallocate(items, count);
+        }
+    }
+
+    static void Destroy(T* items, int count) {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (int i = 0; i < count; ++i) {
+                items[i].~T();
+            }
+        }
+    }
+
+    //  count    ;   
+    //   
+    static void CopyConstruct(const T* from, int count, T* to) {
+        int i = 0;
+        try {
+            for (; i < count; ++i) {
+                new (to + i) T(from[i]);
+            }
+        }
+        catch (...) {
+            Destroy(to, i);
+            throw;
+        }
+    }
+
+    //      :   - memcpy,
+    //  -  (,    )
+    static void Relocate(T* from, int count, T* to, std::true_type) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), sizeof(T) * count);
+        }
+    }
+
+    static void Relocate(T* from, int count, T* to, std::false_type) {
+        int i = 0;
+        try {
+            for (; i < count; ++i) {
+                new (to + i) T(std::move_if_noexcept(from[i]));
+            }
+        }
+        catch (...) {
+            Destroy(to, i);
+            throw;
+        }
+        Destroy(from, count);
+    }
+
+    //   ,    
+    void ReleaseBuffer() {
+        if (data != inlineData) {
+            Deallocate(data, capacity);
+        }
+    }
+
+    //   other   *this.  other   , 
+    //       (  
+    //  noexcept-  )
+    void TakeElements(DynamicArray<T>& other) noexcept {
+        if (other.data != other.inlineData) {
+            ReleaseBuffer();
+            data = other.data;
+            size = other.size;
+            capacity = other.capacity;
+            other.data = other.inlineData;
+            other.size = 0;
+            other.capacity = other.inlineCapacity;
+        }
+        else {
+            if (capacity < other.size) {
+                ReleaseBuffer();
+                data = Allocate(other.size);
+                capacity = other.size;
+            }
+            Relocate(other.data, other.size, data, Trivial());
+            size = other.size;
+            other.size = 0;
+        }
+    }
 
     void Resize(int newCapacity)
     {
         if (newCapacity < size)
             newCapacity = size;
 
-        T* newData = new T[newCapacity];
-        for (int i = 0; i < size; ++i) {
-            newData[i] = data[i];
+        T* newData = Allocate(newCapacity);
+        try {
+            Relocate(data, size, newData, Trivial());
+        }
+        catch (...) {
+            Deallocate(newData, newCapacity);
+            throw;
         }
-        delete[] data;
+        ReleaseBuffer();
         data = newData;
         capacity = newCapacity;
     }
 
+    int GrownCapacity() const {
+        return capacity > 0 ? capacity * 2 : 10;
+    }
+
+protected:
+    //  ,       
+    struct InlineBuffer {};
+
+    //        inlineCapacity 
+    DynamicArray(InlineBuffer, T* inlineBuffer, int inlineCapacity)
+        : data(inlineBuffer), size(0), capacity(inlineCapacity), inlineData(inlineBuffer), inlineCapacity(inlineCapacity) {}
+
 public:
-    // 
+    typedef T value_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    //   Sequence:   ,   -  .
+    //       ToBegin/ToEnd,   - begin()/end()
     class DynamicArrayIterator : public Sequence<T>::Iterator {
     private:
         T* current;
@@ -52,38 +174,151 @@ public:
         }
     };
 
-    DynamicArray() : size(0), capacity(10) {
-        data = new T[capacity];
-    }
+    //        
+    DynamicArray() : data(nullptr), size(0), capacity(0) {}
 
     DynamicArray(int initialCapacity) : size(0), capacity(initialCapacity) {
         if (capacity <= 0) capacity = 10;
-        data = new T[capacity];
+        data = Allocate(capacity);
     }
 
     //  
-    DynamicArray(const DynamicArray<T>& other) {
-        size = other.size;
-        capacity = other.capacity;
-        data = new T[capacity];
-        for (int i = 0; i < size; ++i) {
-            data[i] = other.data[i];
+    DynamicArray(const DynamicArray<T>& other) : size(0), capacity(other.size) {
+        data = Allocate(capacity);
+        try {
+            CopyConstruct(other.data, other.size, data);
+        }
+        catch (...) {
+            Deallocate(data, capacity);
+            throw;
         }
+        size = other.size;
+    }
+
+    //  :  , other  
+    DynamicArray(DynamicArray<T>&& other) noexcept : data(nullptr), size(0), capacity(0) {
+        TakeElements(other);
     }
 
     //   
-    DynamicArray(T* items, int itemsSize) {
-        size = itemsSize;
+    DynamicArray(T* items, int itemsSize) : size(0) {
         capacity = itemsSize * 2;
         if (capacity < 10) capacity = 10;
-        data = new T[capacity];
-        for (int i = 0; i < size; ++i) {
-            data[i] = items[i];
+        data = Allocate(capacity);
+        try {
+            CopyConstruct(items, itemsSize, data);
+        }
+        catch (...) {
+            Deallocate(data, capacity);
+            throw;
+        }
+        size = itemsSize;
+    }
+
+    //    (,   )
+    explicit DynamicArray(ArrayView<const T> items) : size(0), capacity(items.GetLength()) {
+        data = Allocate(capacity);
+        try {
+            CopyConstruct(items.GetData(), items.GetLength(), data);
+        }
+        catch (...) {
+            Deallocate(data, capacity);
+            throw;
+        }
+        size = items.GetLength();
+    }
+
+    //   ,      (  
+    //  ),  -  ,     
+    DynamicArray<T>& operator=(const DynamicArray<T>& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (capacity >= other.size) {
+            Clear();
+            CopyConstruct(other.data, other.size, data);
+            size = other.size;
         }
+        else {
+            DynamicArray<T> copy(other);
+            SwapContents(copy);
+        }
+        return *this;
+    }
+
+    DynamicArray<T>& operator=(DynamicArray<T>&& other) noexcept {
+        if (this != &other) {
+            Destroy(data, size);
+            size = 0;
+            TakeElements(other);
+        }
+        return *this;
     }
 
     ~DynamicArray() {
-        delete[] data;
+        Destroy(data, size);
+        ReleaseBuffer();
+    }
+
+    //  :  O(1)  ,     
+    //      ,  -  
+    void SwapContents(DynamicArray<T>& other) {
+        if (UsesInlineBuffer() || other.UsesInlineBuffer()) {
+            DynamicArray<T> temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+            return;
+        }
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(capacity, other.capacity);
+    }
+
+    bool UsesInlineBuffer() const {
+        return inlineData && data == inlineData;
+    }
+
+    //    newCapacity    
+    void Reserve(int newCapacity) {
+        if (newCapacity > capacity) {
+            Resize(newCapacity);
+        }
+    }
+
+    int GetCapacity() const {
+        return capacity;
+    }
+
+    //      .   
+    //    :        
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size < capacity) {
+            new (data + size) T(std::forward<Args>(args)...);
+        }
+        else {
+            int newCapacity = GrownCapacity();
+            T* newData = Allocate(newCapacity);
+            try {
+                new (newData + size) T(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Deallocate(newData, newCapacity);
+                throw;
+            }
+            try {
+                Relocate(data, size, newData, Trivial());
+            }
+            catch (...) {
+                newData[size].~T();
+                Deallocate(newData, newCapacity);
+                throw;
+            }
+            ReleaseBuffer();
+            data = newData;
+            capacity = newCapacity;
+        }
+        return data[size++];
     }
 
     T& operator[](int index) {
@@ -116,9 +351,9 @@ public:
     }
 
     void Swap(T& a, T& b) override {
-        T temp = a;
-        a = b;
-        b = temp;
+        T temp = std::move(a);
+        a = std::move(b);
+        b = std::move(temp);
     }
 
     int GetLength() override {
@@ -129,26 +364,33 @@ public:
         return size;
     }
 
+    //      Sequence;    
     void Append(T dataElem) override {
-        Insert(dataElem, size);
+        EmplaceBack(std::move(dataElem));
     }
 
     void Prepend(T dataElem) override {
-        Insert(dataElem, 0);
+        Insert(std::move(dataElem), 0);
     }
 
     void Insert(T dataElem, int index) override {
         if (index < 0 || index > size) {
             throw std::out_of_range("Insert index out of range");
         }
-        if (size >= capacity) {
-            Resize(capacity * 2);
+        if (index == size) {
+            EmplaceBack(std::move(dataElem));
+            return;
         }
-        for (int i = size; i > index; i--) {
-            data[i] = data[i - 1];
+        if (size >= capacity) {
+            Resize(GrownCapacity());
         }
-        data[index] = dataElem;
+        //      ,   
+        new (data + size) T(std::move(data[size - 1]));
         size++;
+        for (int i = size - 2; i > index; i--) {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[index] = std::move(dataElem);
     }
 
     void Union(Sequence<T>* seq) override {
@@ -163,11 +405,33 @@ public:
             throw std::out_of_range("Invalid subsequence indices");
         }
         int length = endIndex - startIndex + 1;
-        T* items = new T[length];
-        for (int i = 0; i < length; i++) {
-            items[i] = data[startIndex + i];
-        }
-        return new DynamicArray<T>(items, length);
+        return new DynamicArray<T>(data + startIndex, length);
+    }
+
+    //  [startIndex, endIndex]  
+    ArrayView<T> GetSubsequenceView(int startIndex, int endIndex) {
+        return View().GetSubsequence(startIndex, endIndex);
+    }
+
+    ArrayView<const T> GetSubsequenceView(int startIndex, int endIndex) const {
+        return View().GetSubsequence(startIndex, endIndex);
+    }
+
+    //   ;    
+    ArrayView<T> View() {
+        return ArrayView<T>(data, size);
+    }
+
+    ArrayView<const T> View() const {
+        return ArrayView<const T>(data, size);
+    }
+
+    operator ArrayView<T>() {
+        return View();
+    }
+
+    operator ArrayView<const T>() const {
+        return View();
     }
 
     //    
@@ -176,15 +440,15 @@ public:
             throw std::out_of_range("RemoveAt: index out of range");
         }
         for (int i = index; i < size - 1; i++) {
-            data[i] = data[i + 1];
+            data[i] = std::move(data[i + 1]);
         }
         size--;
+        data[size].~T();
     }
 
-    // 
+    // :  ,     
     void Clear() {
-        delete[] data;
-        data = new T[capacity];
+        Destroy(data, size);
         size = 0;
     }
 
@@ -197,7 +461,33 @@ public:
         std::cout << std::endl;
     }
 
-    // :
+    //  STL -    : range-for, <algorithm>,
+    //  .     
+    iterator begin() {
+        return data;
+    }
+
+    iterator end() {
+        return data + size;
+    }
+
+    const_iterator begin() const {
+        return data;
+    }
+
+    const_iterator end() const {
+        return data + size;
+    }
+
+    const_iterator cbegin() const {
+        return data;
+    }
+
+    const_iterator cend() const {
+        return data + size;
+    }
+
+    //  Sequence ( ),  :
     typename Sequence<T>::Iterator* ToBegin() override {
         return new DynamicArrayIterator(data);
     }
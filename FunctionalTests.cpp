@@ -1,5 +1,51 @@
 #include "FunctionalTests.h"
 
+static void checkFindAndUpsert(IDictionary<int, int>& dict) {
+    assert(dict.find(1) == nullptr);
+
+    Pair<int*, bool> result = dict.tryEmplace(1, 10);
+    assert(result.value && *result.key == 10);
+    result = dict.tryEmplace(1, 20);
+    assert(!result.value && *result.key == 10);
+
+    *dict.find(1) += 5;
+    assert(dict.get(1) == 15);
+
+    for (int i = 0; i < 100; i++) {
+        dict.upsert(i % 10, [](int& count) { count++; });
+    }
+    assert(dict.get(1) == 25);
+    assert(dict.get(9) == 10);
+
+    const IDictionary<int, int>& constDict = dict;
+    assert(*constDict.find(9) == 10);
+    assert(constDict.find(100) == nullptr);
+}
+
+// Элемент, считающий живые экземпляры и копирования
+struct TrackedValue {
+    static int alive;
+    static int copies;
+    std::string text;
+
+    TrackedValue() { alive++; }
+    explicit TrackedValue(const std::string& text) : text(text) { alive++; }
+    TrackedValue(const TrackedValue& other) : text(other.text) { alive++; copies++; }
+    TrackedValue(TrackedValue&& other) noexcept : text(std::move(other.text)) { alive++; }
+    TrackedValue& operator=(const TrackedValue& other) { text = other.text; copies++; return *this; }
+    TrackedValue& operator=(TrackedValue&& other) noexcept { text = std::move(other.text); return *this; }
+    ~TrackedValue() { alive--; }
+};
+
+int TrackedValue::alive = 0;
+int TrackedValue::copies = 0;
+
+static int loggedMessages = 0;
+
+static void countLogMessage(const std::string&) {
+    loggedMessages++;
+}
+
 void runFunctionalTests() {
     std::cout << "=== Functional Tests ===\n";
 
@@ -18,7 +64,7 @@ void runFunctionalTests() {
             });
 
         fixHist.buildHistogram(data);
-        DynamicArray<Pair<Pair<double, double>, int>> allPairs;
+        SmallDynamicArray<Pair<Pair<double, double>, int>, 4> allPairs;
         fixHist.getDictionary()->getAllPairs(allPairs);
         assert(allPairs.GetLength() == 2);
         int totalCount = 0;
@@ -59,5 +105,1311 @@ void runFunctionalTests() {
         std::cout << "[OK] SparseMatrix basic test passed.\n";
     }
 
+    {
+        GroupHashTable<Pair<int, int>, double> groupDict;
+        for (int i = 0; i < 1000; i++) {
+            groupDict.insert(Pair<int, int>(i, i % 7), i * 0.5);
+        }
+        assert(groupDict.size() == 1000);
+        assert(groupDict.get(Pair<int, int>(500, 500 % 7)) == 250.0);
+        assert(!groupDict.exist(Pair<int, int>(500, 1000)));
+
+        for (int i = 0; i < 1000; i += 2) {
+            assert(groupDict.remove(Pair<int, int>(i, i % 7)));
+        }
+        assert(!groupDict.remove(Pair<int, int>(0, 0)));
+        assert(groupDict.size() == 500);
+        assert(groupDict.exist(Pair<int, int>(999, 999 % 7)));
+        assert(!groupDict.exist(Pair<int, int>(998, 998 % 7)));
+
+        SparseMatrix<double> matrix(&groupDict, 1000, 1000);
+        matrix.set(3, 3, 2.5);
+        assert(matrix.get(3, 3) == 2.5);
+
+        std::cout << "[OK] GroupHashTable basic test passed.\n";
+    }
+
+    {
+        HashTable<Pair<int, int>, double> incDict(11, 0.75, true);
+        bool sawMigration = false;
+        for (int i = 0; i < 5000; i++) {
+            incDict.insert(Pair<int, int>(i, -i), i * 1.0);
+            if (incDict.isMigrating()) {
+                sawMigration = true;
+                assert(incDict.exist(Pair<int, int>(0, 0)));
+                assert(incDict.get(Pair<int, int>(i / 2, -(i / 2))) == (i / 2) * 1.0);
+            }
+        }
+        assert(sawMigration);
+        assert(incDict.size() == 5000);
+
+        for (int i = 0; i < 5000; i += 3) {
+            incDict.insert(Pair<int, int>(i, -i), -1.0);
+        }
+        for (int i = 1; i < 5000; i += 3) {
+            assert(incDict.remove(Pair<int, int>(i, -i)));
+        }
+        assert(incDict.get(Pair<int, int>(3, -3)) == -1.0);
+        assert(!incDict.exist(Pair<int, int>(4, -4)));
+
+        DynamicArray<Pair<Pair<int, int>, double>> allPairs;
+        incDict.getAllPairs(allPairs);
+        assert(allPairs.GetLength() == incDict.size());
+
+        std::cout << "[OK] HashTable incremental rehash test passed.\n";
+    }
+
+    {
+        HashTable<int, int> hashDict;
+        checkFindAndUpsert(hashDict);
+        HashTable<int, int> incDict(3, 0.75, true);
+        checkFindAndUpsert(incDict);
+        GroupHashTable<int, int> groupDict;
+        checkFindAndUpsert(groupDict);
+        BalanceBinaryTree<int, int> treeDict;
+        checkFindAndUpsert(treeDict);
+
+        std::cout << "[OK] find/tryEmplace/upsert test passed.\n";
+    }
+
+    {
+        RobinHoodHashTable<Pair<int, int>, double> robinDict;
+        for (int i = 0; i < 2000; i++) {
+            robinDict.insert(Pair<int, int>(i % 50, i / 50), i * 1.0);
+        }
+        assert(robinDict.size() == 2000);
+        for (int i = 0; i < 2000; i += 2) {
+            assert(robinDict.remove(Pair<int, int>(i % 50, i / 50)));
+        }
+        assert(!robinDict.remove(Pair<int, int>(0, 0)));
+        assert(robinDict.size() == 1000);
+        for (int i = 1; i < 2000; i += 2) {
+            assert(robinDict.get(Pair<int, int>(i % 50, i / 50)) == i * 1.0);
+        }
+        assert(!robinDict.exist(Pair<int, int>(2, 0)));
+
+        RobinHoodHashTable<int, int> robinChecked;
+        checkFindAndUpsert(robinChecked);
+
+        std::cout << "[OK] RobinHoodHashTable test passed.\n";
+    }
+
+    {
+        // Ключи (0, v) с хешем 2v раньше упирались в короткий цикл проб
+        HashTable<Pair<int, int>, double, DefaultHash<Pair<int, int>>, PowerOfTwoCapacity> powDict(8, 0.9);
+        HashTable<Pair<int, int>, double> primeDict(11, 0.9);
+        for (int i = 0; i < 3000; i++) {
+            powDict.insert(Pair<int, int>(0, i), i * 1.0);
+            primeDict.insert(Pair<int, int>(0, i), i * 1.0);
+        }
+        assert(powDict.size() == 3000 && primeDict.size() == 3000);
+        for (int i = 0; i < 3000; i++) {
+            assert(powDict.get(Pair<int, int>(0, i)) == i * 1.0);
+            assert(primeDict.get(Pair<int, int>(0, i)) == i * 1.0);
+        }
+        assert((powDict.getCapacity() & (powDict.getCapacity() - 1)) == 0);
+
+        HashTable<int, int, DefaultHash<int>, PowerOfTwoCapacity> powChecked(3, 0.75, true);
+        checkFindAndUpsert(powChecked);
+
+        std::cout << "[OK] HashTable capacity policy test passed.\n";
+    }
+
+    {
+        // Однопоточно ShardedHashTable - обычный IDictionary, включая find/tryEmplace
+        ShardedHashTable<int, int> shardedDict(8);
+        checkFindAndUpsert(shardedDict);
+        IDictionary<int, int>& shardedInterface = shardedDict;
+        int value = -1;
+        assert(!shardedInterface.tryGet(100, value) && value == -1);
+        assert(shardedInterface.tryGet(1, value) && value == 25);
+        assert(shardedInterface.upsert(1, [](int& count) { count++; }) == 26);
+
+        // Счётчики из нескольких потоков не теряют обновлений благодаря атомарному upsert
+        ShardedHashTable<int, int> counters(4);
+        std::thread workers[4];
+        for (int t = 0; t < 4; t++) {
+            workers[t] = std::thread([&counters]() {
+                for (int i = 0; i < 10000; i++) {
+                    counters.upsert(i % 100, [](int& count) { count++; });
+                }
+            });
+        }
+        for (int t = 0; t < 4; t++) {
+            workers[t].join();
+        }
+        assert(counters.size() == 100);
+        for (int i = 0; i < 100; i++) {
+            assert(counters.get(i) == 400);
+        }
+
+        // Гистограмма, заполняемая из нескольких потоков через IDictionary, считает точно
+        ShardedHashTable<Pair<double, double>, int> sharedBins(4);
+        FixedHistogram<double> sharedHistogram(&sharedBins, 0.0, 100.0, 10, [](const double& x) { return x; });
+        DynamicArray<double> histogramData;
+        for (int i = 0; i < 20000; i++) {
+            histogramData.Append((i % 1000) * 0.1);
+        }
+        sharedHistogram.buildHistogram(DynamicArray<double>());
+        for (int t = 0; t < 4; t++) {
+            workers[t] = std::thread([&sharedHistogram, &histogramData]() {
+                sharedHistogram.addData(histogramData);
+            });
+        }
+        for (int t = 0; t < 4; t++) {
+            workers[t].join();
+        }
+        DynamicArray<Pair<Pair<double, double>, int>> sharedCounts;
+        sharedBins.getAllPairs(sharedCounts);
+        assert(sharedCounts.GetLength() == 10);
+        int sharedTotal = 0;
+        for (const Pair<Pair<double, double>, int>& bin : sharedCounts) {
+            sharedTotal += bin.value;
+        }
+        assert(sharedTotal == 4 * 20000);
+
+        std::cout << "[OK] ShardedHashTable test passed.\n";
+    }
+
+    {
+        HashTable<Pair<int, int>, double> batchDict;
+        batchDict.reserve(1000);
+        int reservedCapacity = batchDict.getCapacity();
+        SparseMatrix<double> matrix(&batchDict, 100, 100);
+
+        DynamicArray<Pair<Pair<int, int>, double>> elements;
+        for (int i = 0; i < 1000; i++) {
+            elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(i / 10, i % 10), i + 1.0));
+        }
+        elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(0, 5), 0.0));
+        elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(0, 6), 0.0));
+        elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(0, 6), 7.5));
+        matrix.setBatch(elements);
+
+        assert(batchDict.size() == 999);
+        assert(batchDict.getCapacity() == reservedCapacity);
+        assert(matrix.get(0, 5) == 0.0);
+        assert(matrix.get(0, 6) == 7.5);
+        assert(matrix.get(99, 9) == 1000.0);
+
+        DynamicArray<Pair<int, int>> keys;
+        keys.Append(Pair<int, int>(1, 1));
+        keys.Append(Pair<int, int>(0, 5));
+        DynamicArray<bool> present;
+        batchDict.existBatch(keys, present);
+        assert(present.GetElem(0) && !present.GetElem(1));
+
+        keys.RemoveAt(1);
+        DynamicArray<double> values;
+        batchDict.getBatch(keys, values);
+        assert(values.GetLength() == 1 && values.GetElem(0) == 12.0);
+
+        std::cout << "[OK] HashTable batch operations test passed.\n";
+    }
+
+    {
+        HashTable<int, int, DefaultHash<int>, PrimeCapacity, HashTableStats> statsDict;
+        statsDict.setLogSink(countLogMessage);
+        for (int i = 0; i < 100; i++) {
+            statsDict.insert(i, i);
+        }
+        for (int i = 0; i < 10; i++) {
+            assert(statsDict.remove(i));
+        }
+        assert(!statsDict.exist(5));
+
+        HashTableStatsSnapshot snapshot = statsDict.stats();
+        assert(snapshot.operations == 100 + 10 + 1);
+        long long histogramTotal = 0;
+        for (int b = 0; b < HashTableStatsSnapshot::PROBE_BUCKETS; b++) {
+            histogramTotal += snapshot.probeCounts[b];
+        }
+        assert(histogramTotal == snapshot.operations);
+        assert(snapshot.maxProbeLength >= 1 && snapshot.totalProbes >= snapshot.operations);
+        assert(snapshot.rehashCount > 0 && loggedMessages > 0);
+        assert(snapshot.tombstones == 10);
+        assert(snapshot.size == 90 && snapshot.capacity == statsDict.getCapacity());
+
+        statsDict.resetStats();
+        assert(statsDict.stats().operations == 0 && statsDict.stats().tombstones == 10);
+
+        // Без политики статистики счётчики не ведутся
+        HashTable<int, int> plainDict;
+        for (int i = 0; i < 100; i++) {
+            plainDict.insert(i, i);
+        }
+        assert(plainDict.stats().operations == 0 && plainDict.stats().size == 100);
+
+        std::cout << "[OK] HashTable statistics test passed.\n";
+    }
+
+    {
+        const std::string matrixPath = "functional_test_matrix.snapshot";
+        HashTable<Pair<int, int>, double> matrixDict;
+        SparseMatrix<double> matrix(&matrixDict, 100, 100);
+        for (int i = 0; i < 500; i++) {
+            matrix.set(i / 10, i % 10, i + 0.5);
+        }
+        matrix.set(3, 3, 0.0);
+        MappedHashTable<Pair<int, int>, double>::save(matrixDict, matrixPath);
+
+        {
+            MappedHashTable<Pair<int, int>, double> mappedDict(matrixPath);
+            SparseMatrix<double> mappedMatrix(&mappedDict, 100, 100);
+            assert(mappedDict.size() == 499);
+            assert(mappedMatrix.get(0, 0) == 0.5);
+            assert(mappedMatrix.get(49, 9) == 499.5);
+            assert(mappedMatrix.get(3, 3) == 0.0);
+            assert(!mappedDict.exist(Pair<int, int>(60, 0)));
+
+            DynamicArray<Pair<Pair<int, int>, double>> nonZero;
+            mappedMatrix.getNonZeroElements(nonZero);
+            assert(nonZero.GetLength() == 499);
+
+            bool threw = false;
+            try {
+                mappedMatrix.set(1, 1, 2.0);
+            }
+            catch (const std::runtime_error&) {
+                threw = true;
+            }
+            assert(threw);
+        }
+        std::remove(matrixPath.c_str());
+
+        const std::string binsPath = "functional_test_bins.snapshot";
+        HashTable<Pair<double, double>, int> binsDict;
+        binsDict.insert(Pair<double, double>(0.0, 0.5), 3);
+        binsDict.insert(Pair<double, double>(0.5, 1.0), 7);
+        MappedHashTable<Pair<double, double>, int>::save(binsDict, binsPath);
+
+        {
+            MappedHashTable<Pair<double, double>, int> mappedBins(binsPath);
+            assert(mappedBins.get(Pair<double, double>(0.5, 1.0)) == 7);
+            assert(mappedBins.find(Pair<double, double>(1.0, 1.5)) == nullptr);
+
+            // Снимок другого типа не открывается
+            bool threw = false;
+            try {
+                MappedHashTable<Pair<int, int>, double> wrongType(binsPath);
+            }
+            catch (const std::runtime_error&) {
+                threw = true;
+            }
+            assert(threw);
+        }
+
+        // Повреждённый файл, где заняты все ячейки: поиск отсутствующего ключа завершается
+        std::FILE* corrupted = std::fopen(binsPath.c_str(), "r+b");
+        assert(corrupted);
+        SnapshotFormat::Header header;
+        assert(std::fread(&header, sizeof(header), 1, corrupted) == 1);
+        DynamicArray<char> fullStates((int)header.capacity);
+        for (uint64_t i = 0; i < header.capacity; i++) {
+            fullStates.Append(1);
+        }
+        assert(std::fseek(corrupted, (long)header.statesOffset, SEEK_SET) == 0);
+        assert(std::fwrite(fullStates.begin(), 1, (size_t)header.capacity, corrupted) == (size_t)header.capacity);
+        std::fclose(corrupted);
+        {
+            MappedHashTable<Pair<double, double>, int> corruptedBins(binsPath);
+            assert(corruptedBins.get(Pair<double, double>(0.0, 0.5)) == 3);
+            assert(!corruptedBins.exist(Pair<double, double>(1.0, 1.5)));
+        }
+        std::remove(binsPath.c_str());
+
+        std::cout << "[OK] HashTable snapshot test passed.\n";
+    }
+
+    {
+        assert(sizeof(HashEntry<Pair<int, int>, double>) == 16);
+
+        HashTable<Pair<int, int>, double> packedDict;
+        HashTable<Pair<int, int>, double, DefaultHash<Pair<int, int>>, PrimeCapacity, NoHashTableStats,
+            HashEntry<Pair<int, int>, double, false>> plainDict;
+        for (int i = -50; i < 50; i++) {
+            packedDict.insert(Pair<int, int>(i, -i), i * 1.5);
+            plainDict.insert(Pair<int, int>(i, -i), i * 1.5);
+        }
+        packedDict.insert(Pair<int, int>(INT_MIN, INT_MAX), 7.0);
+        assert(packedDict.remove(Pair<int, int>(0, 0)));
+        assert(plainDict.remove(Pair<int, int>(0, 0)));
+
+        assert(packedDict.size() == 100 && plainDict.size() == 99);
+        assert(packedDict.get(Pair<int, int>(-7, 7)) == -10.5);
+        assert(packedDict.get(Pair<int, int>(INT_MIN, INT_MAX)) == 7.0);
+        assert(!packedDict.exist(Pair<int, int>(0, 0)));
+
+        DynamicArray<Pair<Pair<int, int>, double>> pairs;
+        packedDict.getAllPairs(pairs);
+        double sum = 0.0;
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            const Pair<Pair<int, int>, double>& p = pairs.GetElem(i);
+            if (p.key.key != INT_MIN) {
+                assert(p.key.value == -p.key.key && p.value == p.key.key * 1.5);
+            }
+            sum += p.value;
+        }
+        assert(sum == -75.0 + 7.0);
+
+        // Зарезервированные координаты не хранятся и не находятся
+        assert(!packedDict.exist(Pair<int, int>(INT_MIN, INT_MIN + 1)));
+        bool threw = false;
+        try {
+            packedDict.insert(Pair<int, int>(INT_MIN, INT_MIN), 1.0);
+        }
+        catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        std::cout << "[OK] HashTable packed Pair<int, int> key test passed.\n";
+    }
+
+    {
+        typedef Pair<double, double> Bin;
+        HashTable<Bin, int, DefaultHash<Bin>, PrimeCapacity, NoHashTableStats, CachedHashEntry<Bin, int>> binDict;
+        HashTable<Bin, int, DefaultHash<Bin>, PrimeCapacity, NoHashTableStats, CachedHashEntry<Bin, int>>
+            incrementalDict(11, 0.75, true);
+        for (int i = 0; i < 1000; i++) {
+            binDict.insert(Bin(i * 0.5, i * 0.5 + 0.5), i);
+            incrementalDict.insert(Bin(i * 0.5, i * 0.5 + 0.5), i);
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            assert(binDict.remove(Bin(i * 0.5, i * 0.5 + 0.5)));
+            assert(incrementalDict.remove(Bin(i * 0.5, i * 0.5 + 0.5)));
+        }
+        assert(binDict.size() == 666 && incrementalDict.size() == 666);
+        for (int i = 0; i < 1000; i++) {
+            Bin bin(i * 0.5, i * 0.5 + 0.5);
+            assert(binDict.exist(bin) == (i % 3 != 0));
+            assert(incrementalDict.exist(bin) == (i % 3 != 0));
+            if (i % 3 != 0) {
+                assert(binDict.get(bin) == i && incrementalDict.get(bin) == i);
+            }
+        }
+        HashTable<int, int, DefaultHash<int>, PrimeCapacity, NoHashTableStats, CachedHashEntry<int, int>> counters;
+        checkFindAndUpsert(counters);
+
+        HashTable<std::string, int, DefaultHash<std::string>, PrimeCapacity, NoHashTableStats,
+            CachedHashEntry<std::string, int>> names;
+        for (int i = 0; i < 200; i++) {
+            names.insert("key-" + std::to_string(i), i);
+        }
+        assert(names.get("key-123") == 123 && !names.exist("key-200"));
+
+        std::cout << "[OK] HashTable cached hash entry test passed.\n";
+    }
+
+    {
+        BalanceBinaryTree<Pair<int, int>, double, NodePool> pooledTree;
+        SparseMatrix<double> matrix(&pooledTree, 100, 100);
+        for (int i = 0; i < 3000; i++) {
+            matrix.set(i % 100, i / 100, i + 1.0);
+        }
+        for (int i = 0; i < 3000; i += 2) {
+            matrix.set(i % 100, i / 100, 0.0);
+        }
+        // Освобождённые узлы используются повторно
+        for (int i = 0; i < 3000; i += 2) {
+            matrix.set(i % 100, i / 100, -1.0);
+        }
+        DynamicArray<Pair<Pair<int, int>, double>> elements;
+        matrix.getNonZeroElements(elements);
+        assert(elements.GetLength() == 3000);
+        for (int i = 1; i < elements.GetLength(); i++) {
+            assert(elements.GetElem(i - 1).key < elements.GetElem(i).key);
+        }
+        assert(matrix.get(1, 0) == 2.0 && matrix.get(2, 0) == -1.0);
+
+        // Узлы с нетривиальным деструктором разрушаются обходом дерева
+        BalanceBinaryTree<int, std::string, NodePool> names;
+        for (int i = 0; i < 500; i++) {
+            names.insert(i, "name number " + std::to_string(i));
+        }
+        for (int i = 0; i < 500; i += 5) {
+            assert(names.remove(i));
+        }
+        assert(names.get(499) == "name number 499" && !names.exist(495));
+
+        std::cout << "[OK] BalanceBinaryTree NodePool test passed.\n";
+    }
+
+    {
+        // Случайные вставки и удаления сверяются с хеш-таблицей
+        BalanceBinaryTree<int, int> tree;
+        HashTable<int, int> reference;
+        srand(123);
+        for (int i = 0; i < 20000; i++) {
+            int key = rand() % 3000;
+            if (rand() % 3 == 0) {
+                assert(tree.remove(key) == reference.remove(key));
+            }
+            else {
+                tree.insert(key, i);
+                reference.insert(key, i);
+            }
+        }
+
+        DynamicArray<Pair<int, int>> pairs;
+        tree.getAllPairs(pairs);
+        assert(pairs.GetLength() == reference.size());
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            assert(reference.get(pairs.GetElem(i).key) == pairs.GetElem(i).value);
+            assert(i == 0 || pairs.GetElem(i - 1).key < pairs.GetElem(i).key);
+        }
+        // Высота AVL-дерева: h < 1.45 * log2(n + 2)
+        int bound = 0;
+        for (int n = pairs.GetLength() + 2; n > 1; n >>= 1) {
+            bound++;
+        }
+        assert(tree.height() <= bound * 145 / 100 + 1);
+
+        // Вырожденная последовательность вставок не углубляет дерево
+        BalanceBinaryTree<int, int> sorted;
+        for (int i = 0; i < 100000; i++) {
+            sorted.insert(i, i);
+        }
+        assert(sorted.height() <= 25);
+        for (int i = 0; i < 100000; i += 2) {
+            assert(sorted.remove(i));
+        }
+        assert(!sorted.exist(0) && sorted.get(99999) == 99999 && sorted.height() <= 25);
+
+        std::cout << "[OK] BalanceBinaryTree iterative insert/remove test passed.\n";
+    }
+
+    // Тест упорядоченных запросов BalanceBinaryTree
+    {
+        BalanceBinaryTree<int, int> tree;
+        for (int i = 0; i < 100; i += 10) {
+            tree.insert(i, i * 2);
+        }
+        assert(tree.lowerBound(30)->key == 30);
+        assert(tree.lowerBound(31)->key == 40);
+        assert(tree.upperBound(30)->key == 40);
+        assert(tree.floor(39)->key == 30);
+        assert(tree.ceil(39)->key == 40);
+        assert(tree.lowerBound(91) == nullptr);
+        assert(tree.upperBound(90) == nullptr);
+        assert(tree.floor(-1) == nullptr);
+        assert(tree.floor(1000)->value == 180);
+
+        DynamicArray<Pair<int, int>> range;
+        tree.getRange(25, 60, range);
+        assert(range.GetLength() == 3);
+        assert(range.GetElem(0).key == 30 && range.GetElem(2).key == 50);
+
+        int sum = 0;
+        tree.forEachInRange(0, 100, [&sum](const Pair<int, int>& pair) { sum += pair.value; });
+        assert(sum == 900);
+
+        // Через интерфейс, с пустым и перевёрнутым диапазоном
+        const IOrderedDictionary<int, int>& ordered = tree;
+        int visited = 0;
+        ordered.forEachInRange(40, 40, [&visited](const Pair<int, int>&) { visited++; });
+        ordered.forEachInRange(60, 20, [&visited](const Pair<int, int>&) { visited++; });
+        assert(visited == 0);
+        ordered.forEachInRange(-100, 41, [&visited](const Pair<int, int>&) { visited++; });
+        assert(visited == 5);
+
+        // Строка SparseMatrix: дерево и хеш-таблица дают одинаковый результат
+        BalanceBinaryTree<Pair<int, int>, double> matrixTree;
+        HashTable<Pair<int, int>, double> matrixTable;
+        SparseMatrix<double> treeMatrix(&matrixTree, 10, 10);
+        SparseMatrix<double> tableMatrix(&matrixTable, 10, 10);
+        for (int i = 0; i < 10; i++) {
+            treeMatrix.set(i, (i * 3) % 10, i + 1.0);
+            treeMatrix.set(i, (i * 7) % 10, i + 2.0);
+            tableMatrix.set(i, (i * 3) % 10, i + 1.0);
+            tableMatrix.set(i, (i * 7) % 10, i + 2.0);
+        }
+        for (int i = 0; i < 10; i++) {
+            SmallDynamicArray<Pair<int, double>, 4> treeRow;
+            SmallDynamicArray<Pair<int, double>, 4> tableRow;
+            treeMatrix.getRow(i, treeRow);
+            tableMatrix.getRow(i, tableRow);
+            assert(treeRow.GetLength() == tableRow.GetLength());
+            for (int j = 0; j < treeRow.GetLength(); j++) {
+                assert(treeRow.GetElem(j) == tableRow.GetElem(j));
+                assert(j == 0 || treeRow.GetElem(j - 1).key < treeRow.GetElem(j).key);
+            }
+        }
+
+        // Гистограмма на дереве совпадает с гистограммой на хеш-таблице, включая границы бинов
+        DynamicArray<double> values;
+        for (int i = 0; i <= 100; i++) {
+            values.Append(i * 0.5);
+        }
+        BalanceBinaryTree<Pair<double, double>, int> binTree;
+        HashTable<Pair<double, double>, int> binTable;
+        FixedHistogram<double> treeHistogram(&binTree, 0.0, 50.0, 8, [](const double& v) { return v; });
+        FixedHistogram<double> tableHistogram(&binTable, 0.0, 50.0, 8, [](const double& v) { return v; });
+        treeHistogram.buildHistogram(values);
+        tableHistogram.buildHistogram(values);
+        DynamicArray<Pair<Pair<double, double>, int>> bins;
+        binTree.getAllPairs(bins);
+        int total = 0;
+        for (int i = 0; i < bins.GetLength(); i++) {
+            assert(binTable.get(bins.GetElem(i).key) == bins.GetElem(i).value);
+            total += bins.GetElem(i).value;
+        }
+        assert(total == values.GetLength());
+
+        std::cout << "[OK] BalanceBinaryTree ordered queries test passed.\n";
+    }
+
+    // Тест сборки BalanceBinaryTree из отсортированных пар
+    {
+        DynamicArray<Pair<int, int>> sorted;
+        for (int i = 0; i < 1000; i++) {
+            sorted.Append(Pair<int, int>(i * 2, i));
+        }
+        BalanceBinaryTree<int, int> tree(sorted);
+        // Идеально сбалансированное дерево из 1000 узлов имеет высоту 10
+        assert(tree.size() == 1000 && tree.height() == 10);
+        for (int i = 0; i < 1000; i++) {
+            assert(tree.get(i * 2) == i && !tree.exist(i * 2 + 1));
+        }
+
+        // Слияние: нечётные ключи добавляются, часть чётных получает новые значения
+        DynamicArray<Pair<int, int>> more;
+        for (int i = 0; i < 1000; i++) {
+            more.Append(Pair<int, int>(i * 3, -i));
+        }
+        tree.mergeSorted(more);
+        HashTable<int, int> reference;
+        for (int i = 0; i < 1000; i++) {
+            reference.insert(i * 2, i);
+        }
+        for (int i = 0; i < 1000; i++) {
+            reference.insert(i * 3, -i);
+        }
+        assert(tree.size() == reference.size() && tree.height() == 11);
+        DynamicArray<Pair<int, int>> pairs;
+        tree.getAllPairs(pairs);
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            assert(reference.get(pairs.GetElem(i).key) == pairs.GetElem(i).value);
+        }
+
+        // После слияния дерево остаётся AVL-деревом при вставках и удалениях
+        for (int i = 0; i < 3000; i += 7) {
+            tree.remove(i);
+            tree.insert(-i, i);
+        }
+        assert(tree.get(-7) == 7 && !tree.exist(7));
+
+        // Неупорядоченный вход отвергается, дерево не меняется
+        DynamicArray<Pair<int, int>> unsorted;
+        unsorted.Append(Pair<int, int>(5, 0));
+        unsorted.Append(Pair<int, int>(5, 1));
+        bool thrown = false;
+        try {
+            tree.mergeSorted(unsorted);
+        }
+        catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && tree.get(-7) == 7);
+
+        // Копия независима от исходного дерева
+        BalanceBinaryTree<int, int> copy(tree);
+        assert(copy.size() == tree.size() && copy.height() <= tree.height());
+        copy.insert(1, 100);
+        assert(!tree.exist(1) && copy.get(1) == 100);
+        BalanceBinaryTree<int, int, NodePool> pooled;
+        pooled.insert(42, 42);
+        BalanceBinaryTree<int, int, NodePool> pooledCopy(pooled);
+        pooledCopy = pooled;
+        pooled.remove(42);
+        assert(pooledCopy.get(42) == 42 && pooledCopy.size() == 1);
+
+        // Отсортированный пакет SparseMatrix::setBatch вливается слиянием
+        BalanceBinaryTree<Pair<int, int>, double> matrixTree;
+        SparseMatrix<double> matrix(&matrixTree, 100, 100);
+        DynamicArray<Pair<Pair<int, int>, double>> elements;
+        for (int row = 0; row < 100; row++) {
+            elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(row, row), row + 1.0));
+        }
+        matrix.setBatch(elements);
+        assert(matrixTree.size() == 100 && matrixTree.height() == 7 && matrix.get(50, 50) == 51.0);
+
+        std::cout << "[OK] BalanceBinaryTree bulk build test passed.\n";
+    }
+
+    // Тест порядковых статистик BalanceBinaryTree
+    {
+        BalanceBinaryTree<int, int, NewDeleteAllocator, true> tree;
+        HashTable<int, int> reference;
+        srand(77);
+        for (int i = 0; i < 20000; i++) {
+            int key = rand() % 2000;
+            if (rand() % 3 == 0) {
+                assert(tree.remove(key) == reference.remove(key));
+            }
+            else {
+                tree.insert(key, i);
+                reference.insert(key, i);
+            }
+        }
+        DynamicArray<Pair<int, int>> pairs;
+        tree.getAllPairs(pairs);
+        assert(tree.size() == pairs.GetLength());
+        for (int k = 0; k < pairs.GetLength(); k++) {
+            assert(tree.select(k) == pairs.GetElem(k));
+            assert(tree.rank(pairs.GetElem(k).key) == k);
+        }
+        assert(tree.rank(-1) == 0 && tree.rank(5000) == tree.size());
+        int inRange = 0;
+        for (int k = 0; k < pairs.GetLength(); k++) {
+            inRange += (pairs.GetElem(k).key >= 300 && pairs.GetElem(k).key < 700) ? 1 : 0;
+        }
+        assert(tree.countInRange(300, 700) == inRange && tree.countInRange(700, 300) == 0);
+
+        bool thrown = false;
+        try {
+            tree.select(tree.size());
+        }
+        catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        // Размеры поддеревьев верны и после сборки из отсортированных пар и копирования
+        BalanceBinaryTree<int, int, NodePool, true> built(pairs);
+        BalanceBinaryTree<int, int, NodePool, true> copy(built);
+        assert(copy.select(pairs.GetLength() / 2) == pairs.GetElem(pairs.GetLength() / 2));
+        assert(copy.rank(pairs.GetElem(10).key) == 10);
+
+        // Потоковая гистограмма с равным числом элементов в бинах
+        HashTable<Pair<double, double>, int> bins;
+        FloatingHistogram<double> histogram(&bins, 10, [](const double& v) { return v; });
+        for (int i = 99; i >= 0; i--) {
+            histogram.addValue(i * 1.0);
+        }
+        histogram.updateBins();
+        assert(bins.size() == 10 && bins.get(Pair<double, double>(30.0, 39.0)) == 10);
+        for (int i = 0; i < 5; i++) {
+            assert(histogram.removeValue(i * 1.0));
+        }
+        assert(!histogram.removeValue(0.0) && histogram.valueCount() == 95);
+        histogram.updateBins();
+        assert(bins.size() == 9 && bins.get(Pair<double, double>(5.0, 14.0)) == 10);
+        assert(bins.get(Pair<double, double>(85.0, 99.0)) == 15);
+
+        std::cout << "[OK] BalanceBinaryTree order statistics test passed.\n";
+    }
+
+    // Тест объединения, пересечения и разности BalanceBinaryTree
+    {
+        typedef BalanceBinaryTree<int, int, NewDeleteAllocator, true> CountedTree;
+        CountedTree first;
+        CountedTree second;
+        HashTable<int, int> firstReference;
+        HashTable<int, int> secondReference;
+        srand(55);
+        for (int i = 0; i < 30000; i++) {
+            int key = rand() % 60000;
+            first.insert(key, i);
+            firstReference.insert(key, i);
+        }
+        // Второе дерево меньше и пересекается с первым лишь частично
+        for (int i = 0; i < 5000; i++) {
+            int key = 30000 + rand() % 60000;
+            second.insert(key, 1);
+            secondReference.insert(key, 1);
+        }
+
+        // Проверка содержимого, размеров поддеревьев и высоты АВЛ-дерева
+        auto check = [](const CountedTree& tree, const DynamicArray<Pair<int, int>>& expected) {
+            DynamicArray<Pair<int, int>> pairs;
+            tree.getAllPairs(pairs);
+            assert(tree.size() == expected.GetLength() && pairs.GetLength() == expected.GetLength());
+            for (int k = 0; k < pairs.GetLength(); k++) {
+                assert(pairs.GetElem(k) == expected.GetElem(k));
+                assert(tree.select(k) == expected.GetElem(k));
+            }
+            int bits = 1;
+            for (int n = tree.size() + 2; n > 1; n >>= 1) {
+                bits++;
+            }
+            assert(tree.height() <= 1.45 * bits);
+        };
+        DynamicArray<Pair<int, int>> firstPairs;
+        DynamicArray<Pair<int, int>> secondPairs;
+        first.getAllPairs(firstPairs);
+        second.getAllPairs(secondPairs);
+        DynamicArray<Pair<int, int>> unionExpected;
+        DynamicArray<Pair<int, int>> intersectionExpected;
+        DynamicArray<Pair<int, int>> differenceExpected;
+        for (int k = 0; k < firstPairs.GetLength(); k++) {
+            const Pair<int, int>& pair = firstPairs.GetElem(k);
+            if (secondReference.exist(pair.key)) {
+                intersectionExpected.Append(Pair<int, int>(pair.key, pair.value + 1));
+            }
+            else {
+                differenceExpected.Append(pair);
+            }
+        }
+        for (int a = 0, b = 0; a < firstPairs.GetLength() || b < secondPairs.GetLength();) {
+            if (b == secondPairs.GetLength() || (a < firstPairs.GetLength() && firstPairs.GetElem(a).key < secondPairs.GetElem(b).key)) {
+                unionExpected.Append(firstPairs.GetElem(a++));
+            }
+            else if (a == firstPairs.GetLength() || secondPairs.GetElem(b).key < firstPairs.GetElem(a).key) {
+                unionExpected.Append(secondPairs.GetElem(b++));
+            }
+            else {
+                unionExpected.Append(Pair<int, int>(firstPairs.GetElem(a).key, firstPairs.GetElem(a).value + 1));
+                a++;
+                b++;
+            }
+        }
+
+        auto sum = [](const int& mine, const int& theirs) { return mine + theirs; };
+        CountedTree united(first);
+        united.unionWith(second, sum);
+        check(united, unionExpected);
+        CountedTree intersection(first);
+        intersection.intersectWith(second, sum);
+        check(intersection, intersectionExpected);
+        CountedTree difference(first);
+        difference.subtract(second);
+        check(difference, differenceExpected);
+        check(second, secondPairs);
+
+        // Меньшее дерево с большим: результат тот же, значения берутся из своего дерева
+        CountedTree reversed(second);
+        reversed.unionWith(first, [](const int& mine, const int&) { return mine; });
+        DynamicArray<Pair<int, int>> reversedPairs;
+        reversed.getAllPairs(reversedPairs);
+        assert(reversedPairs.GetLength() == unionExpected.GetLength());
+        for (int k = 0; k < reversedPairs.GetLength(); k++) {
+            int key = reversedPairs.GetElem(k).key;
+            assert(reversedPairs.GetElem(k).value == (secondReference.exist(key) ? 1 : firstReference.get(key)));
+        }
+
+        // Операции с самим собой и с пустым деревом
+        CountedTree empty;
+        united.unionWith(empty, sum);
+        check(united, unionExpected);
+        CountedTree self(second);
+        self.unionWith(self, sum);
+        assert(self.size() == second.size() && self.get(secondPairs.GetElem(0).key) == 2);
+        self.intersectWith(empty, sum);
+        assert(self.size() == 0 && self.height() == 0);
+        difference.subtract(difference);
+        assert(difference.size() == 0);
+
+        // Пул узлов: ветви идут последовательно
+        BalanceBinaryTree<int, int, NodePool> pooled(firstPairs);
+        BalanceBinaryTree<int, int, NodePool> pooledOther(secondPairs);
+        pooled.unionWith(pooledOther, sum);
+        DynamicArray<Pair<int, int>> pooledPairs;
+        pooled.getAllPairs(pooledPairs);
+        assert(pooled.size() == unionExpected.GetLength());
+        for (int k = 0; k < pooledPairs.GetLength(); k++) {
+            assert(pooledPairs.GetElem(k) == unionExpected.GetElem(k));
+        }
+
+        std::cout << "[OK] BalanceBinaryTree set operations test passed.\n";
+    }
+
+    // Тест PersistentTree
+    {
+        PersistentTree<int, int> tree;
+        HashTable<int, int> reference;
+        // Снимки и копии их содержимого на момент публикации
+        DynamicArray<PersistentTree<int, int>::Snapshot*> snapshots;
+        DynamicArray<DynamicArray<Pair<int, int>>*> expected;
+        srand(99);
+        for (int i = 0; i < 20000; i++) {
+            int key = rand() % 2000;
+            if (rand() % 3 == 0) {
+                assert(tree.remove(key) == reference.remove(key));
+            }
+            else {
+                tree.insert(key, i);
+                reference.insert(key, i);
+            }
+            if (i % 2000 == 1999) {
+                tree.publish();
+                snapshots.Append(new PersistentTree<int, int>::Snapshot(tree.snapshot()));
+                expected.Append(new DynamicArray<Pair<int, int>>());
+                tree.getAllPairs(*expected.GetLastElem());
+            }
+        }
+        assert(tree.size() == reference.size());
+        DynamicArray<Pair<int, int>> pairs;
+        tree.getAllPairs(pairs);
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            assert(reference.get(pairs.GetElem(i).key) == pairs.GetElem(i).value);
+        }
+
+        // Изменяемый доступ писателя не затрагивает опубликованные версии
+        int* value = tree.find(pairs.GetElem(0).key);
+        *value = -1;
+        tree.upsert(pairs.GetElem(1).key, [](int& v) { v = -2; });
+
+        // Каждый снимок видит ровно то состояние, в котором был опубликован
+        for (int s = 0; s < snapshots.GetLength(); s++) {
+            DynamicArray<Pair<int, int>> seen;
+            snapshots.GetElem(s)->getAllPairs(seen);
+            assert(seen.GetLength() == expected.GetElem(s)->GetLength());
+            assert(snapshots.GetElem(s)->size() == seen.GetLength());
+            for (int i = 0; i < seen.GetLength(); i++) {
+                assert(seen.GetElem(i) == expected.GetElem(s)->GetElem(i));
+            }
+            delete snapshots.GetElem(s);
+            delete expected.GetElem(s);
+        }
+        assert(tree.snapshot().get(pairs.GetElem(0).key) != -1);
+        tree.publish();
+        assert(tree.snapshot().get(pairs.GetElem(0).key) == -1);
+
+        // Снимок доступен только для чтения
+        PersistentTree<int, int>::Snapshot last = tree.snapshot();
+        bool thrown = false;
+        try {
+            last.insert(1, 1);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && last.lowerBound(pairs.GetElem(2).key)->key == pairs.GetElem(2).key);
+
+        // SparseMatrix читает из снимка
+        PersistentTree<Pair<int, int>, double> matrixTree;
+        SparseMatrix<double> writer(&matrixTree, 10, 10);
+        writer.set(1, 2, 3.0);
+        matrixTree.publish();
+        writer.set(1, 2, 4.0);
+        PersistentTree<Pair<int, int>, double>::Snapshot matrixSnapshot = matrixTree.snapshot();
+        SparseMatrix<double> reader(&matrixSnapshot, 10, 10);
+        assert(reader.get(1, 2) == 3.0 && writer.get(1, 2) == 4.0);
+
+        // Читатели в других потоках видят только целые версии: все значения - 2 * ключ,
+        // а число пар не убывает
+        PersistentTree<int, int> shared;
+        std::atomic<bool> done(false);
+        std::atomic<int> failures(0);
+        auto readerLoop = [&shared, &done, &failures]() {
+            int lastSize = 0;
+            while (!done.load()) {
+                PersistentTree<int, int>::Snapshot snapshot = shared.snapshot();
+                DynamicArray<Pair<int, int>> seen;
+                snapshot.getAllPairs(seen);
+                if (seen.GetLength() != snapshot.size() || snapshot.size() < lastSize) {
+                    failures++;
+                }
+                for (int i = 0; i < seen.GetLength(); i++) {
+                    if (seen.GetElem(i).value != seen.GetElem(i).key * 2) {
+                        failures++;
+                    }
+                }
+                lastSize = snapshot.size();
+            }
+        };
+        std::thread readerA(readerLoop);
+        std::thread readerB(readerLoop);
+        for (int i = 0; i < 20000; i++) {
+            shared.insert((i * 7919) % 20000, ((i * 7919) % 20000) * 2);
+            if (i % 100 == 99) {
+                shared.publish();
+            }
+        }
+        done = true;
+        readerA.join();
+        readerB.join();
+        assert(failures.load() == 0 && shared.snapshot().size() == 20000);
+
+        std::cout << "[OK] PersistentTree test passed.\n";
+    }
+
+    // Тест BPlusTree
+    {
+        // Маленький ORDER, чтобы деления и слияния шли на нескольких уровнях
+        BPlusTree<Pair<int, int>, int, 8> tree;
+        HashTable<Pair<int, int>, int> reference;
+        srand(321);
+        for (int i = 0; i < 30000; i++) {
+            Pair<int, int> key(rand() % 60 - 30, rand() % 100 - 50);
+            if (rand() % 3 == 0) {
+                assert(tree.remove(key) == reference.remove(key));
+            }
+            else {
+                tree.insert(key, i);
+                reference.insert(key, i);
+            }
+        }
+        assert(tree.size() == reference.size());
+        assert(tree.height() > 2);
+
+        DynamicArray<Pair<Pair<int, int>, int>> pairs;
+        tree.getAllPairs(pairs);
+        assert(pairs.GetLength() == reference.size());
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            assert(reference.get(pairs.GetElem(i).key) == pairs.GetElem(i).value);
+            assert(tree.get(pairs.GetElem(i).key) == pairs.GetElem(i).value);
+            assert(i == 0 || pairs.GetElem(i - 1).key < pairs.GetElem(i).key);
+        }
+
+        // Границы совпадают с AVL-деревом на тех же ключах
+        BalanceBinaryTree<Pair<int, int>, int> avl;
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            avl.insert(pairs.GetElem(i).key, pairs.GetElem(i).value);
+        }
+        for (int row = -32; row < 32; row++) {
+            for (int col = -52; col < 52; col += 3) {
+                Pair<int, int> key(row, col);
+                assert(tree.lowerBound(key) == nullptr ? avl.lowerBound(key) == nullptr : *tree.lowerBound(key) == *avl.lowerBound(key));
+                assert(tree.upperBound(key) == nullptr ? avl.upperBound(key) == nullptr : *tree.upperBound(key) == *avl.upperBound(key));
+                assert(tree.floor(key) == nullptr ? avl.floor(key) == nullptr : *tree.floor(key) == *avl.floor(key));
+            }
+            DynamicArray<Pair<Pair<int, int>, int>> treeRow;
+            DynamicArray<Pair<Pair<int, int>, int>> avlRow;
+            tree.getRange(Pair<int, int>(row, INT_MIN), Pair<int, int>(row + 1, INT_MIN), treeRow);
+            avl.getRange(Pair<int, int>(row, INT_MIN), Pair<int, int>(row + 1, INT_MIN), avlRow);
+            assert(treeRow.GetLength() == avlRow.GetLength());
+            for (int i = 0; i < treeRow.GetLength(); i++) {
+                assert(treeRow.GetElem(i) == avlRow.GetElem(i));
+            }
+        }
+
+        // Удаление всех ключей сворачивает дерево до одного листа
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            assert(tree.remove(pairs.GetElem(i).key));
+        }
+        assert(tree.size() == 0 && tree.height() == 1 && tree.lowerBound(Pair<int, int>(0, 0)) == nullptr);
+
+        // Строковые ключи ищутся двоичным поиском
+        BPlusTree<std::string, int> names;
+        for (int i = 0; i < 2000; i++) {
+            names.insert("key" + std::to_string(i), i);
+        }
+        for (int i = 0; i < 2000; i += 2) {
+            assert(names.remove("key" + std::to_string(i)));
+        }
+        assert(names.size() == 1000 && !names.exist("key0") && names.get("key1999") == 1999);
+        assert(names.upsert("key1", [](int& v) { v += 10; }) == 11);
+        assert(names.lowerBound("key1000")->key == "key1001");
+
+        // SparseMatrix на B+-дереве
+        BPlusTree<Pair<int, int>, double> matrixTree;
+        SparseMatrix<double> matrix(&matrixTree, 100, 100);
+        for (int i = 0; i < 100; i++) {
+            matrix.set(i, (i * 7) % 100, i + 1.0);
+        }
+        DynamicArray<Pair<int, double>> row;
+        matrix.getRow(3, row);
+        assert(row.GetLength() == 1 && row.GetElem(0).key == 21 && row.GetElem(0).value == 4.0);
+
+        std::cout << "[OK] BPlusTree test passed.\n";
+    }
+
+    // Тест DynamicArray: сырая память, перемещение элементов, сохранение буфера
+    {
+        {
+            DynamicArray<TrackedValue> values(4);
+            assert(TrackedValue::alive == 0);
+            for (int i = 0; i < 100; i++) {
+                values.EmplaceBack("value number " + std::to_string(i) + " with a heap-allocated text");
+            }
+            values.Append(TrackedValue("appended"));
+            values.Insert(TrackedValue("first"), 0);
+            values.RemoveAt(50);
+            assert(TrackedValue::alive == 101 && TrackedValue::copies == 0);
+            assert(values.GetElem(0).text == "first" && values.GetElem(1).text.find("value number 0 ") == 0);
+            assert(values.GetElem(50).text.find("value number 50 ") == 0);
+            assert(values.GetLastElem().text == "appended");
+
+            // Аргумент EmplaceBack может ссылаться на элемент самого массива при росте
+            while (values.GetLength() < values.GetCapacity()) {
+                values.EmplaceBack("padding");
+            }
+            values.EmplaceBack(values.GetElem(0));
+            assert(values.GetLastElem().text == "first" && TrackedValue::copies == 1);
+
+            DynamicArray<TrackedValue> copy(values);
+            DynamicArray<TrackedValue> moved(std::move(values));
+            assert(values.GetLength() == 0 && moved.GetLength() == copy.GetLength());
+            values = copy;
+            copy = std::move(moved);
+            values = values;
+            assert(values.GetLength() == copy.GetLength() && values.GetElem(7).text == copy.GetElem(7).text);
+
+            DynamicArray<TrackedValue>* slice = copy.GetSubsequence(1, 10);
+            assert(slice->GetLength() == 10 && slice->GetElem(0).text == copy.GetElem(1).text);
+            delete slice;
+
+            int capacity = values.GetCapacity();
+            int aliveBefore = TrackedValue::alive;
+            int length = values.GetLength();
+            values.Clear();
+            assert(values.GetLength() == 0 && values.GetCapacity() == capacity);
+            assert(TrackedValue::alive == aliveBefore - length);
+            values.Append(TrackedValue("again"));
+            assert(values.GetCapacity() == capacity && values.GetFirstElem().text == "again");
+        }
+        assert(TrackedValue::alive == 0);
+
+        // Тривиально копируемые элементы переносятся memcpy
+        DynamicArray<Pair<int, int>> pairs;
+        for (int i = 0; i < 1000; i++) {
+            pairs.Append(Pair<int, int>(i, -i));
+        }
+        pairs.Prepend(Pair<int, int>(-1, 1));
+        pairs.Reserve(5000);
+        assert(pairs.GetCapacity() == 5000 && pairs.GetLength() == 1001);
+        for (int i = 0; i < 1000; i++) {
+            assert((pairs.GetElem(i + 1) == Pair<int, int>(i, -i)));
+        }
+
+        std::cout << "[OK] DynamicArray storage test passed.\n";
+    }
+
+    // Тест ArrayView: внешние буферы и участки массивов без копирования
+    {
+        double buffer[] = { 5.0, 1.0, 4.0, 2.0, 3.0, 9.0, 8.0 };
+        ArrayView<double> whole(buffer);
+        ArrayView<const double> middle = whole.Slice(1, 4);
+        assert(middle.GetLength() == 4 && middle.GetData() == buffer + 1 && middle.GetLastElem() == 3.0);
+        whole[1] = 1.5;
+        assert(middle.GetFirstElem() == 1.5);
+
+        bool thrown = false;
+        try {
+            whole.Slice(5, 3);
+        }
+        catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown && whole.Slice(7, 0).IsEmpty());
+
+        // Гистограмма по участку внешнего буфера
+        HashTable<Pair<double, double>, int> fixedBins;
+        FixedHistogram<double> fixed(&fixedBins, 0.0, 10.0, 2, [](const double& x) { return x; });
+        fixed.buildHistogram(middle);
+        assert(fixedBins.get(Pair<double, double>(0.0, 5.0)) == 4 && fixedBins.get(Pair<double, double>(5.0, 10.0)) == 0);
+        HashTable<Pair<double, double>, int> floatingBins;
+        FloatingHistogram<double> floating(&floatingBins, 2, [](const double& x) { return x; });
+        floating.buildHistogram(whole.GetSubsequence(3, 6));
+        assert(floatingBins.size() == 2 && floatingBins.get(Pair<double, double>(2.0, 3.0)) == 2);
+
+        // Представление DynamicArray указывает на его буфер
+        DynamicArray<Pair<Pair<int, int>, double>> elements;
+        for (int i = 0; i < 100; i++) {
+            elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(i, i), i + 1.0));
+        }
+        elements.GetElem(50).value = 0.0;
+        ArrayView<const Pair<Pair<int, int>, double>> tail = elements.GetSubsequenceView(40, 99);
+        assert(&tail.GetFirstElem() == &elements.GetElem(40));
+        HashTable<Pair<int, int>, double> cells;
+        SparseMatrix<double> matrix(&cells, 100, 100);
+        matrix.set(50, 50, 7.0);
+        matrix.setBatch(tail);
+        assert(cells.size() == 59 && matrix.get(50, 50) == 0.0 && matrix.get(40, 40) == 41.0 && matrix.get(39, 39) == 0.0);
+
+        DynamicArray<Pair<int, int>> keys;
+        keys.Append(Pair<int, int>(41, 41));
+        keys.Append(Pair<int, int>(50, 50));
+        keys.Append(Pair<int, int>(0, 0));
+        DynamicArray<bool> present;
+        cells.existBatch(keys.GetSubsequenceView(0, 1), present);
+        assert(present.GetLength() == 2 && present.GetElem(0) && !present.GetElem(1));
+
+        // Копия участка - обычный DynamicArray
+        DynamicArray<double> copy(middle);
+        assert(copy.GetLength() == 4 && copy.GetElem(3) == 3.0);
+
+        std::cout << "[OK] ArrayView test passed.\n";
+    }
+
+    // Тест итераторов STL у DynamicArray и LinkedList
+    {
+        DynamicArray<int> numbers;
+        for (int i = 0; i < 100; i++) {
+            numbers.Append((i * 37) % 100);
+        }
+        std::sort(numbers.begin(), numbers.end());
+        int expected = 0;
+        for (int value : numbers) {
+            assert(value == expected++);
+        }
+        const DynamicArray<int>& constNumbers = numbers;
+        assert(std::find(constNumbers.begin(), constNumbers.end(), 42) - constNumbers.begin() == 42);
+        assert(std::accumulate(numbers.cbegin(), numbers.cend(), 0) == 4950);
+        DynamicArray<int> empty;
+        assert(empty.begin() == empty.end());
+        ArrayView<const int> view = numbers.GetSubsequenceView(10, 19);
+        assert(std::accumulate(view.begin(), view.end(), 0) == 145);
+
+        LinkedList<std::string> words;
+        words.Append("beta");
+        words.Append("gamma");
+        words.Prepend("alpha");
+        static_assert(std::is_same<std::iterator_traits<LinkedList<int>::iterator>::iterator_category,
+            std::forward_iterator_tag>::value, "LinkedList iterator must be a forward iterator");
+        std::string joined;
+        for (const std::string& word : words) {
+            joined += word;
+        }
+        assert(joined == "alphabetagamma");
+        LinkedList<std::string>::iterator found = std::find(words.begin(), words.end(), "beta");
+        assert(found != words.end() && found->size() == 4);
+        *found = "delta";
+        LinkedList<std::string>::const_iterator constFound = found;
+        assert(*constFound == "delta" && words.GetElem(1) == "delta");
+        assert(constFound == found && found == constFound && !(constFound != found));
+        assert(words.cend() != found && found != words.cend() && words.cbegin() == words.begin());
+        assert(std::distance(words.cbegin(), words.cend()) == 3);
+        assert(LinkedList<int>().begin() == LinkedList<int>().end());
+
+        // Виртуальные итераторы Sequence продолжают работать
+        Sequence<int>* sequence = &numbers;
+        Sequence<int>::Iterator* it = sequence->ToBegin();
+        Sequence<int>::Iterator* last = sequence->ToEnd();
+        int visited = 0;
+        for (; *it != *last; ++*it) {
+            assert(**it == visited++);
+        }
+        assert(visited == 100);
+        delete it;
+        delete last;
+
+        std::cout << "[OK] STL iterators test passed.\n";
+    }
+
+    // Тест сортировок и FloatingHistogram::buildHistogram
+    {
+        srand(31);
+        DynamicArray<double> values;
+        for (int i = 0; i < 200000; i++) {
+            values.Append((rand() % 2000001 - 1000000) / 7.0);
+        }
+        values.Append(-0.0);
+        values.Append(0.0);
+        values.Append(std::numeric_limits<double>::infinity());
+        values.Append(-std::numeric_limits<double>::infinity());
+        values.Append(std::numeric_limits<double>::denorm_min());
+        DynamicArray<double> expected(values);
+        std::sort(expected.begin(), expected.end());
+
+        // Один поток и принудительно несколько (кусков меньше SORT_MIN_CHUNK)
+        for (int threads = 1; threads <= 4; threads += 3) {
+            DynamicArray<double> radix(values);
+            RadixSort(radix, threads);
+            assert(std::equal(expected.begin(), expected.end(), radix.begin()));
+            // -0.0 идёт перед всеми 0.0
+            assert(std::signbit(*std::lower_bound(radix.begin(), radix.end(), 0.0)));
+            DynamicArray<double> merged(values);
+            ParallelSort(merged, [](double a, double b) { return a < b; }, threads);
+            assert(std::equal(expected.begin(), expected.end(), merged.begin()));
+        }
+
+        // SortByKey устойчива и вызывает key один раз на элемент
+        DynamicArray<Pair<int, std::string>> records;
+        for (int i = 0; i < 5000; i++) {
+            records.Append(Pair<int, std::string>(i % 7, "record " + std::to_string(i)));
+        }
+        for (int threads = 1; threads <= 3; threads += 2) {
+            DynamicArray<Pair<int, std::string>> byDouble(records);
+            int calls = 0;
+            SortByKey(byDouble, [&calls](const Pair<int, std::string>& r) { calls++; return r.key * -1.5; }, threads);
+            assert(calls == records.GetLength());
+            DynamicArray<Pair<int, std::string>> byInt(records);
+            SortByKey(byInt, [](const Pair<int, std::string>& r) { return r.key; }, threads);
+            for (int i = 1; i < records.GetLength(); i++) {
+                const Pair<int, std::string>& prev = byDouble.GetElem(i - 1);
+                const Pair<int, std::string>& cur = byDouble.GetElem(i);
+                assert(prev.key > cur.key || (prev.key == cur.key && std::stoi(prev.value.substr(7)) < std::stoi(cur.value.substr(7))));
+                assert(byInt.GetElem(i - 1).key < byInt.GetElem(i).key ||
+                    (byInt.GetElem(i - 1).key == byInt.GetElem(i).key &&
+                        std::stoi(byInt.GetElem(i - 1).value.substr(7)) < std::stoi(byInt.GetElem(i).value.substr(7))));
+            }
+        }
+
+        // Бины по отсортированным значениям: поровну элементов, границы - крайние значения
+        HashTable<Pair<double, double>, int> bins;
+        FloatingHistogram<double> histogram(&bins, 1000, [](const double& x) { return x; });
+        histogram.buildHistogram(values.GetSubsequenceView(0, 99999));
+        DynamicArray<double> prefix(values.GetSubsequenceView(0, 99999));
+        std::sort(prefix.begin(), prefix.end());
+        assert(bins.size() <= 100);
+        for (int b = 0; b < 100; b++) {
+            Pair<double, double> bin(prefix.GetElem(b * 1000), prefix.GetElem(b * 1000 + 999));
+            assert(bins.exist(bin));
+        }
+
+        std::cout << "[OK] Sort and FloatingHistogram build test passed.\n";
+    }
+
+    // SmallDynamicArray: встроенный буфер, переход в кучу, перемещения и копирования
+    {
+        SmallDynamicArray<int, 4> small;
+        assert(small.UsesInlineBuffer() && small.GetCapacity() == 4);
+        for (int i = 0; i < 4; i++) {
+            small.Append(i);
+        }
+        assert(small.UsesInlineBuffer());
+        small.Append(4);
+        assert(!small.UsesInlineBuffer() && small.GetLength() == 5);
+        for (int i = 0; i < 5; i++) {
+            assert(small[i] == i);
+        }
+        small.Clear();
+        assert(small.GetLength() == 0 && small.GetCapacity() >= 5);
+
+        // Выгрузка в массив из встроенного буфера через интерфейс DynamicArray
+        HashTable<int, int> table;
+        for (int i = 0; i < 3; i++) {
+            table.insert(i, i * i);
+        }
+        SmallDynamicArray<Pair<int, int>, 8> pairs;
+        table.getAllPairs(pairs);
+        assert(pairs.UsesInlineBuffer() && pairs.GetLength() == 3);
+        int squares = 0;
+        for (const Pair<int, int>& pair : pairs) {
+            assert(pair.value == pair.key * pair.key);
+            squares += pair.value;
+        }
+        assert(squares == 5);
+
+        {
+            SmallDynamicArray<TrackedValue, 2> inlineValues;
+            inlineValues.EmplaceBack("a");
+            inlineValues.EmplaceBack("b");
+            assert(TrackedValue::alive == 2);
+
+            // Из встроенного буфера элементы переносятся, из кучи - буфер забирается
+            SmallDynamicArray<TrackedValue, 2> moved(std::move(inlineValues));
+            assert(moved.UsesInlineBuffer() && moved.GetLength() == 2 && inlineValues.GetLength() == 0);
+            assert(moved[0].text == "a" && moved[1].text == "b" && TrackedValue::alive == 2);
+            moved.EmplaceBack("c");
+            DynamicArray<TrackedValue> plain(std::move(moved));
+            assert(plain.GetLength() == 3 && moved.GetLength() == 0 && moved.UsesInlineBuffer());
+            assert(TrackedValue::alive == 3);
+
+            // Копия, которая помещается во встроенный буфер, строится в нём
+            int copiesBefore = TrackedValue::copies;
+            SmallDynamicArray<TrackedValue, 4> copy(plain);
+            assert(copy.UsesInlineBuffer() && copy.GetLength() == 3 && copy[2].text == "c");
+            assert(TrackedValue::copies == copiesBefore + 3);
+
+            // Обмен массива во встроенном буфере с массивом в куче
+            SmallDynamicArray<TrackedValue, 4> other;
+            for (int i = 0; i < 6; i++) {
+                other.EmplaceBack(std::to_string(i));
+            }
+            copy.SwapContents(other);
+            assert(copy.GetLength() == 6 && !copy.UsesInlineBuffer() && copy[5].text == "5");
+            assert(other.GetLength() == 3 && other.UsesInlineBuffer() && other[0].text == "a");
+            plain = other;
+            assert(plain.GetLength() == 3 && plain[1].text == "b");
+        }
+        assert(TrackedValue::alive == 0);
+
+        std::cout << "[OK] SmallDynamicArray test passed.\n";
+    }
+
     std::cout << "All functional tests passed!\n\n";
 }
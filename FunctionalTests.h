@@ -3,8 +3,22 @@
 #include <iostream>
 
 #include "BalanceBinaryTree.h"
+#include "BPlusTree.h"
+#include "PersistentTree.h"
 #include "HashTable.h"
+#include "GroupHashTable.h"
+#include "RobinHoodHashTable.h"
+#include "ShardedHashTable.h"
+#include "HashTableSnapshot.h"
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
 #include "DynamicArray.h"
+#include "SmallDynamicArray.h"
+#include "LinkedList.h"
+#include "ArrayView.h"
+#include "Sort.h"
 #include "Person.h"
 #include "Histogram.h"
 #include "SparseMatrix.h"
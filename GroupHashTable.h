@@ -0,0 +1,317 @@
+// GroupHashTable.h
+#pragma once
+
+#include "IDictionary.h"
+#include "Pair.h"
+#include "DefaultHash.h"
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GROUP_HASH_TABLE_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//  :   = 1     ,
+//    7-   (0..127)
+namespace GroupCtrl {
+    const int8_t EMPTY = -128;  // 0b10000000
+    const int8_t DELETED = -2;  // 0b11111110
+    const int GROUP_WIDTH = 16; //      
+
+    //     (mask != 0)
+    inline int lowestBit(uint32_t mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int)index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    //   ,     value
+    inline uint32_t matchByte(const int8_t* group, int8_t value) {
+#ifdef GROUP_HASH_TABLE_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < GROUP_WIDTH; i++) {
+            if (group[i] == value) mask |= (1u << i);
+        }
+        return mask;
+#endif
+    }
+
+    //   (  )  
+    inline uint32_t matchFree(const int8_t* group) {
+#ifdef GROUP_HASH_TABLE_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return (uint32_t)_mm_movemask_epi8(ctrl);
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < GROUP_WIDTH; i++) {
+            if (group[i] < 0) mask |= (1u << i);
+        }
+        return mask;
+#endif
+    }
+}
+
+// -   :   7-  
+//      ,  16    .
+//      .
+template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>>
+class GroupHashTable : public IDictionary<Key, Value> {
+private:
+    int8_t* ctrl;            //  ,    
+    Pair<Key, Value>* slots; //  -
+    int capacity;            //   ( ,  GROUP_WIDTH)
+    int count;               //   
+    int deletedCount;        //   
+    HashFunc hashFunc;       // -
+
+    //  ,       ,   
+    size_t mixedHash(const Key& key) const {
+        uint64_t h = (uint64_t)hashFunc(key) * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h ^ (h >> 32));
+    }
+
+    static int8_t fingerprint(size_t hash) {
+        return (int8_t)(hash & 0x7F);
+    }
+
+    int groupMask() const {
+        return capacity / GroupCtrl::GROUP_WIDTH - 1;
+    }
+
+    //         (7/8 )
+    int growthLimit() const {
+        return capacity - capacity / 8;
+    }
+
+    static int roundUpCapacity(int n) {
+        int result = GroupCtrl::GROUP_WIDTH;
+        while (result < n) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    void allocate(int newCapacity) {
+        capacity = newCapacity;
+        ctrl = new int8_t[capacity];
+        std::memset(ctrl, GroupCtrl::EMPTY, capacity);
+        slots = new Pair<Key, Value>[capacity];
+        count = 0;
+        deletedCount = 0;
+    }
+
+    //     ; -1,   
+    int findIndex(const Key& key) const {
+        size_t hash = mixedHash(key);
+        int8_t h2 = fingerprint(hash);
+        int mask = groupMask();
+        size_t group = (hash >> 7) & mask;
+
+        //           2^k
+        for (int step = 1; step <= mask + 1; step++) {
+            const int8_t* groupCtrl = ctrl + group * GroupCtrl::GROUP_WIDTH;
+            uint32_t candidates = GroupCtrl::matchByte(groupCtrl, h2);
+            while (candidates) {
+                int i = (int)(group * GroupCtrl::GROUP_WIDTH) + GroupCtrl::lowestBit(candidates);
+                if (slots[i].key == key) {
+                    return i;
+                }
+                candidates &= candidates - 1;
+            }
+            if (GroupCtrl::matchByte(groupCtrl, GroupCtrl::EMPTY)) {
+                return -1;
+            }
+            group = (group + step) & mask;
+        }
+        return -1;
+    }
+
+    //       
+    int findFreeIndex(size_t hash) const {
+        int mask = groupMask();
+        size_t group = (hash >> 7) & mask;
+
+        for (int step = 1; step <= mask + 1; step++) {
+            uint32_t free = GroupCtrl::matchFree(ctrl + group * GroupCtrl::GROUP_WIDTH);
+            if (free) {
+                return (int)(group * GroupCtrl::GROUP_WIDTH) + GroupCtrl::lowestBit(free);
+            }
+            group = (group + step) & mask;
+        }
+        throw std::runtime_error("GroupHashTable is full, cannot insert new key.");
+    }
+
+    //  ;        
+    void rehash() {
+        int oldCapacity = capacity;
+        int8_t* oldCtrl = ctrl;
+        Pair<Key, Value>* oldSlots = slots;
+
+        int newCapacity = (count + 1 > oldCapacity / 2) ? oldCapacity * 2 : oldCapacity;
+        allocate(newCapacity);
+
+        for (int i = 0; i < oldCapacity; i++) {
+            if (oldCtrl[i] >= 0) {
+                size_t hash = mixedHash(oldSlots[i].key);
+                int index = findFreeIndex(hash);
+                ctrl[index] = fingerprint(hash);
+                slots[index] = oldSlots[i];
+                count++;
+            }
+        }
+
+        delete[] oldCtrl;
+        delete[] oldSlots;
+    }
+
+    void copyFrom(const GroupHashTable& other) {
+        capacity = other.capacity;
+        count = other.count;
+        deletedCount = other.deletedCount;
+        hashFunc = other.hashFunc;
+        ctrl = new int8_t[capacity];
+        std::memcpy(ctrl, other.ctrl, capacity);
+        slots = new Pair<Key, Value>[capacity];
+        for (int i = 0; i < capacity; i++) {
+            slots[i] = other.slots[i];
+        }
+    }
+
+public:
+    // 
+    GroupHashTable(int initialCapacity = GroupCtrl::GROUP_WIDTH) : hashFunc(HashFunc()) {
+        allocate(roundUpCapacity(initialCapacity));
+    }
+
+    //  
+    GroupHashTable(const GroupHashTable& other) {
+        copyFrom(other);
+    }
+
+    //   
+    GroupHashTable& operator=(const GroupHashTable& other) {
+        if (this == &other) {
+            return *this;
+        }
+        delete[] ctrl;
+        delete[] slots;
+        copyFrom(other);
+        return *this;
+    }
+
+    // 
+    ~GroupHashTable() {
+        delete[] ctrl;
+        delete[] slots;
+    }
+
+    //   -
+    void insert(const Key& key, const Value& value) override {
+        Pair<Value*, bool> result = tryEmplace(key, value);
+        if (!result.value) {
+            *result.key = value;
+        }
+    }
+
+    // ,     
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        int index = findIndex(key);
+        if (index >= 0) {
+            return Pair<Value*, bool>(&slots[index].value, false);
+        }
+
+        if (count + deletedCount + 1 > growthLimit()) {
+            rehash();
+        }
+
+        size_t hash = mixedHash(key);
+        index = findFreeIndex(hash);
+        if (ctrl[index] == GroupCtrl::DELETED) {
+            deletedCount--;
+        }
+        ctrl[index] = fingerprint(hash);
+        slots[index] = Pair<Key, Value>(key, value);
+        count++;
+        return Pair<Value*, bool>(&slots[index].value, true);
+    }
+
+    //    
+    Value* find(const Key& key) override {
+        int index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    const Value* find(const Key& key) const override {
+        int index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    //   
+    bool exist(const Key& key) const override {
+        return findIndex(key) >= 0;
+    }
+
+    //    
+    Value get(const Key& key) const override {
+        int index = findIndex(key);
+        if (index < 0) {
+            throw std::runtime_error("Key not found in GroupHashTable.");
+        }
+        return slots[index].value;
+    }
+
+    //    
+    bool remove(const Key& key) override {
+        int index = findIndex(key);
+        if (index < 0) {
+            return false;
+        }
+
+        //      ,      ,
+        //        
+        const int8_t* groupCtrl = ctrl + (index / GroupCtrl::GROUP_WIDTH) * GroupCtrl::GROUP_WIDTH;
+        if (GroupCtrl::matchByte(groupCtrl, GroupCtrl::EMPTY)) {
+            ctrl[index] = GroupCtrl::EMPTY;
+        }
+        else {
+            ctrl[index] = GroupCtrl::DELETED;
+            deletedCount++;
+        }
+        slots[index] = Pair<Key, Value>();
+        count--;
+        return true;
+    }
+
+    //    -
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + count);
+        for (int i = 0; i < capacity; i++) {
+            if (ctrl[i] >= 0) {
+                arr.EmplaceBack(slots[i]);
+            }
+        }
+    }
+
+    //  
+    int size() const {
+        return count;
+    }
+
+    //  
+    int getCapacity() const {
+        return capacity;
+    }
+};
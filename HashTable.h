@@ -4,9 +4,23 @@
 #include "IDictionary.h"
 #include "Pair.h"
 #include "DefaultHash.h" // ,      -
+#include "CapacityPolicy.h"
+#include "HashTableStats.h"
 #include <stdexcept>
 #include <functional>
 #include <iostream>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#define HASH_TABLE_PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define HASH_TABLE_PREFETCH(address) __builtin_prefetch(address)
+#endif
 
 //   -
 enum class EntryStatus {
@@ -15,109 +29,476 @@ enum class EntryStatus {
     DELETED
 };
 
-//     -  
-template <typename Key, typename Value>
+// ,       64- 
+template <typename Key>
+struct PackedKey {
+    static const bool value = false;
+};
+
+template <>
+struct PackedKey<Pair<int, int>> {
+    static const bool value = true;
+};
+
+//     -  .
+// HashTable      ,    
+template <typename Key, typename Value, bool Packed = PackedKey<Key>::value>
 struct HashEntry {
+    //        
+    static const bool CACHES_HASH = false;
+
     Pair<Key, Value> pair;
     EntryStatus status;
 
     HashEntry() : pair(), status(EntryStatus::EMPTY) {}
     HashEntry(const Key& key, const Value& value) : pair(key, value), status(EntryStatus::OCCUPIED) {}
+
+    //      
+    static bool isValidKey(const Key&) {
+        return true;
+    }
+
+    bool isEmpty() const { return status == EntryStatus::EMPTY; }
+    bool isDeleted() const { return status == EntryStatus::DELETED; }
+    bool isOccupied() const { return status == EntryStatus::OCCUPIED; }
+
+    //     key (  hash)
+    bool matches(const Key& key, size_t) const {
+        return status == EntryStatus::OCCUPIED && pair.key == key;
+    }
+
+    void occupy(const Key& key, const Value& value, size_t) {
+        pair.key = key;
+        pair.value = value;
+        status = EntryStatus::OCCUPIED;
+    }
+
+    void markDeleted() { status = EntryStatus::DELETED; }
+
+    template <typename HashFunc>
+    size_t getHash(const HashFunc& hashFunc) const { return hashFunc(pair.key); }
+
+    const Key& getKey() const { return pair.key; }
+    Value& getValue() { return pair.value; }
+    const Value& getValue() const { return pair.value; }
+    const Pair<Key, Value>& toPair() const { return pair; }
+};
+
+//    Pair<int, int> ( SparseMatrix):    uint64_t,
+//         .
+//   -   ,    double  16 .
+//  (INT_MIN, INT_MIN)  (INT_MIN, INT_MIN + 1) 
+template <typename Value>
+struct HashEntry<Pair<int, int>, Value, true> {
+    static const bool CACHES_HASH = false;
+    static const uint64_t EMPTY_KEY = 0x8000000080000000ull;
+    static const uint64_t DELETED_KEY = 0x8000000080000001ull;
+
+    uint64_t packedKey;
+    Value value;
+
+    HashEntry() : packedKey(EMPTY_KEY), value() {}
+    HashEntry(const Pair<int, int>& key, const Value& value) : packedKey(HashMix::pack(key.key, key.value)), value(value) {}
+
+    static bool isValidKey(const Pair<int, int>& key) {
+        return key.key != INT_MIN || (key.value != INT_MIN && key.value != INT_MIN + 1);
+    }
+
+    bool isEmpty() const { return packedKey == EMPTY_KEY; }
+    bool isDeleted() const { return packedKey == DELETED_KEY; }
+    bool isOccupied() const { return packedKey != EMPTY_KEY && packedKey != DELETED_KEY; }
+
+    //       ,    
+    bool matches(const Pair<int, int>& key, size_t) const {
+        return packedKey == HashMix::pack(key.key, key.value);
+    }
+
+    void occupy(const Pair<int, int>& key, const Value& newValue, size_t) {
+        packedKey = HashMix::pack(key.key, key.value);
+        value = newValue;
+    }
+
+    void markDeleted() { packedKey = DELETED_KEY; }
+
+    template <typename HashFunc>
+    size_t getHash(const HashFunc& hashFunc) const { return hashFunc(getKey()); }
+
+    Pair<int, int> getKey() const {
+        return Pair<int, int>((int)(uint32_t)(packedKey >> 32), (int)(uint32_t)packedKey);
+    }
+    Value& getValue() { return value; }
+    const Value& getValue() const { return value; }
+    Pair<Pair<int, int>, Value> toPair() const { return Pair<Pair<int, int>, Value>(getKey(), value); }
 };
 
-// -      
-template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>>
+//      :     
+// -,     ,    .
+//         (Pair<double, double>, ).
+//         ,     -
+template <typename Key, typename Value>
+struct CachedHashEntry {
+    static const bool CACHES_HASH = true;
+
+    Pair<Key, Value> pair;
+    size_t hash;
+    EntryStatus status;
+
+    CachedHashEntry() : pair(), hash(0), status(EntryStatus::EMPTY) {}
+
+    static bool isValidKey(const Key&) {
+        return true;
+    }
+
+    bool isEmpty() const { return status == EntryStatus::EMPTY; }
+    bool isDeleted() const { return status == EntryStatus::DELETED; }
+    bool isOccupied() const { return status == EntryStatus::OCCUPIED; }
+
+    bool matches(const Key& key, size_t keyHash) const {
+        return hash == keyHash && status == EntryStatus::OCCUPIED && pair.key == key;
+    }
+
+    void occupy(const Key& key, const Value& value, size_t keyHash) {
+        pair.key = key;
+        pair.value = value;
+        hash = keyHash;
+        status = EntryStatus::OCCUPIED;
+    }
+
+    void markDeleted() { status = EntryStatus::DELETED; }
+
+    template <typename HashFunc>
+    size_t getHash(const HashFunc&) const { return hash; }
+
+    const Key& getKey() const { return pair.key; }
+    Value& getValue() { return pair.value; }
+    const Value& getValue() const { return pair.value; }
+    const Pair<Key, Value>& toPair() const { return pair; }
+};
+
+// -      .
+// CapacityPolicy       (. CapacityPolicy.h),
+// StatsPolicy -   (HashTableStats)    (. HashTableStats.h),
+// Entry -   (  HashEntry,  Pair<int, int> - ;
+// CachedHashEntry   ).
+//        ,
+//         
+template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>,
+    typename CapacityPolicy = PrimeCapacity, typename StatsPolicy = NoHashTableStats,
+    typename Entry = HashEntry<Key, Value>>
 class HashTable : public IDictionary<Key, Value> {
 private:
-    HashEntry<Key, Value>* table; //  
+    Entry* table;                 //  
     int capacity;                 //   
     int count;                    //   
     double loadFactor;            //     
     HashFunc hashFunc;            // -
-    int R;                        //     -
-
-    //  -   
-    size_t secondHash(const Key& key) const {
-        if (capacity <= 1) return 1;
-        return 1 + (hashFunc(key) % (capacity - 1));
-    }
-
-    //        n
-    int previousPrime(int n) const {
-        while (n > 1) {
-            bool isPrime = true;
-            for (int i = 2; i * i <= n; ++i) {
-                if (n % i == 0) {
-                    isPrime = false;
-                    break;
-                }
+    CapacityPolicy sizing;        //     
+
+    //  :   ,    
+    bool incremental;                 //   
+    Entry* oldTable;                  //   (nullptr,    )
+    int oldCapacity;                  //   
+    CapacityPolicy oldSizing;         //    
+    int migrateIndex;                 //      
+
+    //        
+    static const int MIGRATION_STEP = 8;
+
+    mutable StatsPolicy statistics; //    
+    HashTableLogSink logSink;      //   ; nullptr -  
+
+    //   ;     
+    static long long statsClock() {
+        if (!StatsPolicy::enabled) {
+            return 0;
+        }
+        return (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void log(const std::string& message) const {
+        if (logSink) {
+            logSink(message);
+        }
+    }
+
+    //      ,   .
+    //    ,    ,     
+    size_t secondHash(const Key& key, size_t hash) const {
+        if (Entry::CACHES_HASH) {
+            return (size_t)HashMix::mix64((uint64_t)hash ^ HashMix::SEED_SECONDARY);
+        }
+        return SecondHash<HashFunc, Key>::get(hashFunc, key, hash);
+    }
+
+    //     minCapacity
+    void setCapacity(int minCapacity) {
+        sizing.reset(minCapacity > 0 ? minCapacity : 1);
+        capacity = sizing.size();
+    }
+
+    //      (  )   t; -1,   
+    int findIndex(const Entry* t, const CapacityPolicy& policy, const Key& key, size_t hash) const {
+        if (!Entry::isValidKey(key)) {
+            return -1;
+        }
+        size_t index = policy.home(hash);
+        size_t step = policy.step(secondHash(key, hash));
+        int cap = policy.size();
+
+        for (int i = 0; i < cap; i++, index = policy.next(index, step)) {
+            if (t[index].isEmpty()) {
+                //   
+                statistics.recordProbes(i + 1);
+                return -1;
             }
-            if (isPrime) return n;
-            n--;
+            else if (t[index].matches(key, hash)) {
+                statistics.recordProbes(i + 1);
+                return (int)index;
+            }
+            //   DELETED  OCCUPIED   ,  
         }
-        return 7; //    
+        statistics.recordProbes(cap);
+        return -1;
     }
 
-    //     
-    void rehash() {
-        std::cout << "Rehashing: Old capacity = " << capacity << ", Old count = " << count << "\n";
-        int oldCapacity = capacity;
-        HashEntry<Key, Value>* oldTable = table;
+    //   ,      ,   .
+    //    ,    ;    ,   
+    void placeEntry(Entry& entry) {
+        size_t hash = entry.getHash(hashFunc);
+        size_t index = sizing.home(hash);
+        size_t step = sizing.step(secondHash(entry.getKey(), hash));
 
-        //     
-        capacity = oldCapacity * 2;
-        if (capacity <= 0) {
-            capacity = 1;
+        for (int i = 0; i < capacity; i++, index = sizing.next(index, step)) {
+            if (!table[index].isOccupied()) {
+                table[index] = std::move(entry);
+                return;
+            }
         }
+        throw std::runtime_error("HashTable is full, cannot insert new key.");
+    }
 
-        //  R      
-        R = previousPrime(capacity / 2);
+    //   :    ,  
+    void startMigration() {
+        long long started = statsClock();
+        if (logSink) {
+            log("Incremental rehash started: old capacity = " + std::to_string(capacity)
+                + ", count = " + std::to_string(count));
+        }
+        oldTable = table;
+        oldCapacity = capacity;
+        oldSizing = sizing;
+        migrateIndex = 0;
+
+        setCapacity(oldCapacity * 2);
+        table = new Entry[capacity];
+        statistics.recordRehash(statsClock() - started);
+    }
 
-        //   
-        table = new HashEntry<Key, Value>[capacity];
-        for (int i = 0; i < capacity; ++i) {
-            table[i].status = EntryStatus::EMPTY;
+    //    maxSlots     
+    void migrateStep(int maxSlots) {
+        if (!oldTable) return;
+
+        long long started = statsClock();
+        int end = migrateIndex + maxSlots;
+        if (end > oldCapacity) {
+            end = oldCapacity;
+        }
+        for (; migrateIndex < end; migrateIndex++) {
+            if (oldTable[migrateIndex].isOccupied()) {
+                placeEntry(oldTable[migrateIndex]);
+                // DELETED,   EMPTY:       
+                oldTable[migrateIndex].markDeleted();
+            }
         }
-        count = 0; //  
 
-        //       
+        if (migrateIndex >= oldCapacity) {
+            delete[] oldTable;
+            oldTable = nullptr;
+            oldCapacity = 0;
+        }
+        statistics.recordRehashTime(statsClock() - started);
+    }
+
+    void finishMigration() {
+        if (oldTable) {
+            migrateStep(oldCapacity);
+        }
+    }
+
+    void copyOldTableFrom(const HashTable& other) {
+        oldCapacity = other.oldCapacity;
+        oldSizing = other.oldSizing;
+        migrateIndex = other.migrateIndex;
+        oldTable = nullptr;
+        if (other.oldTable) {
+            oldTable = new Entry[oldCapacity];
+            for (int i = 0; i < oldCapacity; i++) {
+                oldTable[i] = other.oldTable[i];
+            }
+        }
+    }
+
+    //  ;    
+    void rehash(int minCapacity = 0) {
+        long long started = statsClock();
+        if (logSink) {
+            log("Rehashing: old capacity = " + std::to_string(capacity) + ", count = " + std::to_string(count));
+        }
+        int oldCapacity = capacity;
+        Entry* oldTable = table;
+
+        //      
+        setCapacity(minCapacity > 0 ? minCapacity : oldCapacity * 2);
+
+        //   
+        table = new Entry[capacity];
+
+        //       :  ,
+        //        ,  count  
         for (int i = 0; i < oldCapacity; i++) {
-            if (oldTable[i].status == EntryStatus::OCCUPIED) {
-                try {
-                    insert(oldTable[i].pair.key, oldTable[i].pair.value);
-                }
-                catch (const std::exception& e) {
-                    std::cerr << "Error during rehashing: " << e.what() << "\n";
-                }
+            if (oldTable[i].isOccupied()) {
+                placeEntry(oldTable[i]);
             }
         }
 
         //    
         delete[] oldTable;
-        std::cout << "Rehashing complete: New capacity = " << capacity << "\n";
+        statistics.recordRehash(statsClock() - started);
+        if (logSink) {
+            log("Rehashing complete: new capacity = " + std::to_string(capacity));
+        }
     }
 
-public:
-    // 
-    HashTable(int initialCapacity = 11, double loadFactor = 0.75)
-        : capacity(initialCapacity), count(0), loadFactor(loadFactor), hashFunc(HashFunc()) {
-        if (capacity <= 0) {
-            capacity = 1;
+    //        .
+    // overwrite = true    .
+    //         ,    
+    Pair<Value*, bool> emplaceEntry(const Key& key, size_t hash, const Value& value, bool overwrite) {
+        if (!Entry::isValidKey(key)) {
+            throw std::invalid_argument("Key is reserved by HashTable and cannot be stored.");
         }
-        table = new HashEntry<Key, Value>[capacity];
-        for (int i = 0; i < capacity; ++i) {
-            table[i].status = EntryStatus::EMPTY;
+        migrateStep(MIGRATION_STEP);
+
+        // ,     
+        if ((double)(count + 1) / capacity > loadFactor) {
+            if (incremental) {
+                finishMigration();
+                startMigration();
+            }
+            else {
+                log("Load factor exceeded. Initiating rehash.");
+                rehash();
+            }
+        }
+
+        //          .  
+        //     : markDeleted   
+        const Value* source = &value;
+        bool moved = false;
+        if (oldTable) {
+            int oldIndex = findIndex(oldTable, oldSizing, key, hash);
+            if (oldIndex >= 0) {
+                if (!overwrite) {
+                    source = &oldTable[oldIndex].getValue();
+                }
+                oldTable[oldIndex].markDeleted();
+                count--;
+                moved = true;
+            }
+        }
+
+        size_t index = sizing.home(hash);
+        size_t step = sizing.step(secondHash(key, hash));
+
+        int firstDeletedIndex = -1;
+
+        for (int i = 0; i < capacity; i++, index = sizing.next(index, step)) {
+            if (table[index].isEmpty()) {
+                //     ,  
+                if (firstDeletedIndex != -1) {
+                    index = firstDeletedIndex;
+                }
+                table[index].occupy(key, *source, hash);
+                count++;
+                statistics.recordProbes(i + 1);
+                return Pair<Value*, bool>(&table[index].getValue(), !moved);
+            }
+            else if (table[index].isDeleted()) {
+                if (firstDeletedIndex == -1) {
+                    firstDeletedIndex = (int)index;
+                }
+            }
+            else if (table[index].matches(key, hash)) {
+                //  ,    
+                if (overwrite) {
+                    table[index].getValue() = value;
+                }
+                statistics.recordProbes(i + 1);
+                return Pair<Value*, bool>(&table[index].getValue(), false);
+            }
+        }
+
+        //        
+        statistics.recordProbes(capacity);
+        if (firstDeletedIndex != -1) {
+            table[firstDeletedIndex].occupy(key, *source, hash);
+            count++;
+            return Pair<Value*, bool>(&table[firstDeletedIndex].getValue(), !moved);
         }
-        R = previousPrime(capacity / 2);
+
+        //    
+        throw std::runtime_error("HashTable is full, cannot insert new key.");
+    }
+
+    //          ; nullptr,   
+    Entry* findEntry(const Key& key, size_t hash) const {
+        int index = findIndex(table, sizing, key, hash);
+        if (index >= 0) {
+            return &table[index];
+        }
+        if (oldTable) {
+            index = findIndex(oldTable, oldSizing, key, hash);
+            if (index >= 0) {
+                return &oldTable[index];
+            }
+        }
+        return nullptr;
+    }
+
+    Entry* findEntry(const Key& key) const {
+        return findEntry(key, hashFunc(key));
+    }
+
+    //           
+    static const int BATCH_GROUP = 16;
+
+    //   keys[start, end)     
+    template <typename GetKey>
+    void prefetchGroup(int start, int end, GetKey getKey, size_t* hashes) const {
+        for (int i = start; i < end; i++) {
+            hashes[i - start] = hashFunc(getKey(i));
+            HASH_TABLE_PREFETCH(&table[sizing.home(hashes[i - start])]);
+        }
+    }
+
+public:
+    // ;  incrementalRehash = true     
+    HashTable(int initialCapacity = 11, double loadFactor = 0.75, bool incrementalRehash = false)
+        : count(0), loadFactor(loadFactor), hashFunc(HashFunc()),
+        incremental(incrementalRehash), oldTable(nullptr), oldCapacity(0), migrateIndex(0), logSink(nullptr) {
+        setCapacity(initialCapacity);
+        table = new Entry[capacity];
     }
 
     //  
     HashTable(const HashTable& other)
-        : capacity(other.capacity), count(other.count), loadFactor(other.loadFactor), hashFunc(other.hashFunc), R(other.R) {
-        table = new HashEntry<Key, Value>[capacity];
+        : capacity(other.capacity), count(other.count), loadFactor(other.loadFactor), hashFunc(other.hashFunc), sizing(other.sizing),
+        incremental(other.incremental), statistics(other.statistics), logSink(other.logSink) {
+        table = new Entry[capacity];
         for (int i = 0; i < capacity; i++) {
             table[i] = other.table[i];
         }
+        copyOldTableFrom(other);
     }
 
     //   
@@ -128,18 +509,23 @@ public:
 
         //   
         delete[] table;
+        delete[] oldTable;
 
         //     
         capacity = other.capacity;
         count = other.count;
         loadFactor = other.loadFactor;
         hashFunc = other.hashFunc;
-        R = other.R;
+        sizing = other.sizing;
+        incremental = other.incremental;
+        statistics = other.statistics;
+        logSink = other.logSink;
 
-        table = new HashEntry<Key, Value>[capacity];
+        table = new Entry[capacity];
         for (int i = 0; i < capacity; i++) {
             table[i] = other.table[i];
         }
+        copyOldTableFrom(other);
 
         return *this;
     }
@@ -147,122 +533,142 @@ public:
     // 
     ~HashTable() {
         delete[] table;
+        delete[] oldTable;
     }
 
     //   -
     void insert(const Key& key, const Value& value) override {
-        // ,     
-        if ((double)(count + 1) / capacity > loadFactor) {
-            std::cout << "Load factor exceeded. Initiating rehash.\n";
-            rehash();
-        }
-
-        size_t hash1 = hashFunc(key) % capacity;
-        size_t hash2 = secondHash(key);
+        emplaceEntry(key, hashFunc(key), value, true);
+    }
 
-        int firstDeletedIndex = -1;
+    // ,     
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        return emplaceEntry(key, hashFunc(key), value, false);
+    }
 
-        for (int i = 0; i < capacity; i++) {
-            size_t index = (hash1 + i * hash2) % capacity;
+    //    
+    Value* find(const Key& key) override {
+        Entry* entry = findEntry(key);
+        return entry ? &entry->getValue() : nullptr;
+    }
 
-            if (table[index].status == EntryStatus::EMPTY) {
-                //     ,  
-                if (firstDeletedIndex != -1) {
-                    table[firstDeletedIndex].pair = Pair<Key, Value>(key, value);
-                    table[firstDeletedIndex].status = EntryStatus::OCCUPIED;
-                }
-                else {
-                    table[index] = HashEntry<Key, Value>(key, value);
-                }
-                count++;
-                return;
-            }
-            else if (table[index].status == EntryStatus::DELETED) {
-                if (firstDeletedIndex == -1) {
-                    firstDeletedIndex = (int)index;
-                }
-            }
-            else if (table[index].status == EntryStatus::OCCUPIED && table[index].pair.key == key) {
-                //  ,    
-                table[index].pair.value = value;
-                return;
-            }
-        }
+    const Value* find(const Key& key) const override {
+        const Entry* entry = findEntry(key);
+        return entry ? &entry->getValue() : nullptr;
+    }
 
-        //        
-        if (firstDeletedIndex != -1) {
-            table[firstDeletedIndex].pair = Pair<Key, Value>(key, value);
-            table[firstDeletedIndex].status = EntryStatus::OCCUPIED;
-            count++;
-            return;
+    bool tryGet(const Key& key, Value& out) const override {
+        const Entry* entry = findEntry(key);
+        if (!entry) {
+            return false;
         }
-
-        //    
-        throw std::runtime_error("HashTable is full, cannot insert new key.");
+        out = entry->getValue();
+        return true;
     }
 
     //   
     bool exist(const Key& key) const override {
-        size_t hash1 = hashFunc(key) % capacity;
-        size_t hash2 = secondHash(key);
-
-        for (int i = 0; i < capacity; i++) {
-            size_t index = (hash1 + i * hash2) % capacity;
-            if (table[index].status == EntryStatus::EMPTY) {
-                //   
-                return false;
-            }
-            else if (table[index].status == EntryStatus::OCCUPIED && table[index].pair.key == key) {
-                return true;
-            }
-            //   DELETED  OCCUPIED   ,  
-        }
-        return false;
+        return findEntry(key) != nullptr;
     }
 
     //    
     Value get(const Key& key) const override {
-        size_t hash1 = hashFunc(key) % capacity;
-        size_t hash2 = secondHash(key);
-
-        for (int i = 0; i < capacity; i++) {
-            size_t index = (hash1 + i * hash2) % capacity;
-            if (table[index].status == EntryStatus::EMPTY) {
-                throw std::runtime_error("Key not found in HashTable.");
-            }
-            else if (table[index].status == EntryStatus::OCCUPIED && table[index].pair.key == key) {
-                return table[index].pair.value;
-            }
-            //  DELETED, 
+        const Entry* entry = findEntry(key);
+        if (!entry) {
+            throw std::runtime_error("Key not found in HashTable.");
         }
-        throw std::runtime_error("Key not found in HashTable.");
+        return entry->getValue();
     }
 
     //    
     bool remove(const Key& key) override {
-        size_t hash1 = hashFunc(key) % capacity;
-        size_t hash2 = secondHash(key);
-
-        for (int i = 0; i < capacity; i++) {
-            size_t index = (hash1 + i * hash2) % capacity;
-            if (table[index].status == EntryStatus::EMPTY) {
-                return false; //   
-            }
-            else if (table[index].status == EntryStatus::OCCUPIED && table[index].pair.key == key) {
-                table[index].status = EntryStatus::DELETED;
+        migrateStep(MIGRATION_STEP);
+
+        size_t hash = hashFunc(key);
+        int index = findIndex(table, sizing, key, hash);
+        if (index >= 0) {
+            table[index].markDeleted();
+            count--;
+            return true;
+        }
+        if (oldTable) {
+            index = findIndex(oldTable, oldSizing, key, hash);
+            if (index >= 0) {
+                oldTable[index].markDeleted();
                 count--;
                 return true;
             }
-            //  DELETED,  
         }
         return false; //   
     }
 
+    //    n ,      
+    void reserve(int n) {
+        if ((double)n / capacity <= loadFactor) {
+            return;
+        }
+        finishMigration();
+        rehash((int)(n / loadFactor) + 1);
+    }
+
+    //  :    ,    
+    //    ,        
+    void insertBatch(ArrayView<const Pair<Key, Value>> pairs) override {
+        int n = pairs.GetLength();
+        reserve(count + n);
+
+        size_t hashes[BATCH_GROUP];
+        for (int start = 0; start < n; start += BATCH_GROUP) {
+            int end = start + BATCH_GROUP < n ? start + BATCH_GROUP : n;
+            prefetchGroup(start, end, [&pairs](int i) -> const Key& { return pairs.GetElem(i).key; }, hashes);
+            for (int i = start; i < end; i++) {
+                const Pair<Key, Value>& pair = pairs.GetElem(i);
+                emplaceEntry(pair.key, hashes[i - start], pair.value, true);
+            }
+        }
+    }
+
+    //   : result[i] -   keys[i]
+    void existBatch(ArrayView<const Key> keys, DynamicArray<bool>& result) const override {
+        int n = keys.GetLength();
+        size_t hashes[BATCH_GROUP];
+        for (int start = 0; start < n; start += BATCH_GROUP) {
+            int end = start + BATCH_GROUP < n ? start + BATCH_GROUP : n;
+            prefetchGroup(start, end, [&keys](int i) -> const Key& { return keys.GetElem(i); }, hashes);
+            for (int i = start; i < end; i++) {
+                result.Append(findEntry(keys.GetElem(i), hashes[i - start]) != nullptr);
+            }
+        }
+    }
+
+    //   ;   get,     
+    void getBatch(ArrayView<const Key> keys, DynamicArray<Value>& result) const override {
+        int n = keys.GetLength();
+        size_t hashes[BATCH_GROUP];
+        for (int start = 0; start < n; start += BATCH_GROUP) {
+            int end = start + BATCH_GROUP < n ? start + BATCH_GROUP : n;
+            prefetchGroup(start, end, [&keys](int i) -> const Key& { return keys.GetElem(i); }, hashes);
+            for (int i = start; i < end; i++) {
+                const Entry* entry = findEntry(keys.GetElem(i), hashes[i - start]);
+                if (!entry) {
+                    throw std::runtime_error("Key not found in HashTable.");
+                }
+                result.Append(entry->getValue());
+            }
+        }
+    }
+
     //    -
     void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + count);
         for (int i = 0; i < capacity; i++) {
-            if (table[i].status == EntryStatus::OCCUPIED) {
-                arr.Append(table[i].pair);
+            if (table[i].isOccupied()) {
+                arr.EmplaceBack(table[i].toPair());
+            }
+        }
+        for (int i = 0; i < oldCapacity; i++) {
+            if (oldTable[i].isOccupied()) {
+                arr.EmplaceBack(oldTable[i].toPair());
             }
         }
     }
@@ -277,13 +683,77 @@ public:
         return capacity;
     }
 
+    // : histogram[k] -     k .
+    //    
+    void probeLengthHistogram(DynamicArray<int>& histogram) const {
+        for (int i = 0; i < capacity; i++) {
+            if (!table[i].isOccupied()) {
+                continue;
+            }
+            Key key = table[i].getKey();
+            size_t hash = table[i].getHash(hashFunc);
+            size_t index = sizing.home(hash);
+            size_t step = sizing.step(secondHash(key, hash));
+            int probes = 1;
+            while (index != (size_t)i) {
+                index = sizing.next(index, step);
+                probes++;
+            }
+            while (histogram.GetLength() <= probes) {
+                histogram.Append(0);
+            }
+            histogram[probes]++;
+        }
+    }
+
+    //  .       ;
+    //  NoHashTableStats      
+    HashTableStatsSnapshot stats() const {
+        HashTableStatsSnapshot snapshot;
+        statistics.fill(snapshot);
+        for (int i = 0; i < capacity; i++) {
+            if (table[i].isDeleted()) {
+                snapshot.tombstones++;
+            }
+        }
+        for (int i = 0; i < oldCapacity; i++) {
+            if (oldTable[i].isDeleted()) {
+                snapshot.tombstones++;
+            }
+        }
+        snapshot.size = count;
+        snapshot.capacity = capacity;
+        return snapshot;
+    }
+
+    //    
+    void resetStats() {
+        statistics = StatsPolicy();
+    }
+
+    //    (); nullptr  
+    void setLogSink(HashTableLogSink sink) {
+        logSink = sink;
+    }
+
+    //       
+    long long memoryUsage() const {
+        return (long long)(capacity + oldCapacity) * (long long)sizeof(Entry);
+    }
+
+    //        
+    bool isMigrating() const {
+        return oldTable != nullptr;
+    }
+
     //  :   
     void display() const {
         std::cout << "HashTable Contents:\n";
         for (int i = 0; i < capacity; ++i) {
-            if (table[i].status == EntryStatus::OCCUPIED) {
-                std::cout << "Index " << i << ": Key = (" << table[i].pair.key.key << ", " << table[i].pair.key.value
-                    << "), Value = " << table[i].pair.value << "\n";
+            if (table[i].isOccupied()) {
+                Pair<Key, Value> pair = table[i].toPair();
+                std::cout << "Index " << i << ": Key = (" << pair.key.key << ", " << pair.key.value
+                    << "), Value = " << pair.value << "\n";
             }
         }
     }
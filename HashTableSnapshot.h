@@ -0,0 +1,338 @@
+// HashTableSnapshot.h
+#pragma once
+
+#include "IDictionary.h"
+#include "DynamicArray.h"
+#include "Pair.h"
+#include "DefaultHash.h"
+#include <stdexcept>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//  : ,    (1   )   .
+//       -     ,
+//  ,   mmap      .
+namespace SnapshotFormat {
+    const char MAGIC[8] = { 'H', 'T', 'S', 'N', 'A', 'P', '1', '\0' };
+    const uint32_t VERSION = 1;
+    const uint32_t ENDIAN_CHECK = 0x01020304;
+    const uint64_t HEADER_SIZE = 128;    //   ;    64 
+    const uint64_t ALIGNMENT = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;      //   
+        uint32_t keySize;        // sizeof(Key)
+        uint32_t valueSize;      // sizeof(Value)
+        uint32_t slotSize;       // sizeof(Pair<Key, Value>)
+        uint32_t reserved;
+        uint64_t capacity;       //   ( )
+        uint64_t count;          //  
+        uint64_t hashCheck;      //  Key():    -
+        uint64_t statesOffset;   //      
+        uint64_t slotsOffset;    //   
+        uint64_t fileSize;       //   
+    };
+
+    inline uint64_t alignUp(uint64_t value) {
+        return (value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    //  :  ,   RobinHoodHashTable
+    inline uint64_t home(size_t hash, int shift) {
+        return ((uint64_t)hash * 0x9E3779B97F4A7C15ull) >> shift;
+    }
+}
+
+//       .    
+//  :     find         
+class MappedFile {
+private:
+    const unsigned char* data;
+    uint64_t length;
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path) : data(nullptr), length(0) {
+#if defined(_WIN32)
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open snapshot file: " + path);
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw std::runtime_error("Cannot read snapshot file size: " + path);
+        }
+        length = (uint64_t)fileSize.QuadPart;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("Cannot map snapshot file: " + path);
+        }
+        data = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (!data) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("Cannot map snapshot file: " + path);
+        }
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open snapshot file: " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            close(fd);
+            throw std::runtime_error("Cannot read snapshot file size: " + path);
+        }
+        length = (uint64_t)info.st_size;
+        void* address = mmap(nullptr, (size_t)length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        //       
+        close(fd);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Cannot map snapshot file: " + path);
+        }
+        data = (const unsigned char*)address;
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        CloseHandle(file);
+#else
+        munmap((void*)data, (size_t)length);
+#endif
+    }
+
+    const unsigned char* bytes() const {
+        return data;
+    }
+
+    uint64_t size() const {
+        return length;
+    }
+};
+
+//       -   .
+//      :  ,  
+//       .
+//    save   IDictionary   
+//   ; -      
+template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>>
+class MappedHashTable : public IDictionary<Key, Value> {
+    static_assert(std::is_trivially_copyable<Key>::value, "Snapshot key must be trivially copyable.");
+    static_assert(std::is_trivially_copyable<Value>::value, "Snapshot value must be trivially copyable.");
+
+private:
+    typedef Pair<Key, Value> Slot;
+
+    MappedFile file;
+    const uint8_t* states;   // 1 -  , 0 - 
+    Slot* slots;
+    uint64_t capacity;
+    uint64_t count;
+    int shift;               // 64 - log2(capacity)
+    HashFunc hashFunc;
+
+    static int shiftFor(uint64_t capacity) {
+        int result = 64;
+        for (uint64_t c = capacity; c > 1; c >>= 1) {
+            result--;
+        }
+        return result;
+    }
+
+    //    ; -1,   
+    int64_t findIndex(const Key& key) const {
+        uint64_t mask = capacity - 1;
+        uint64_t index = SnapshotFormat::home(hashFunc(key), shift);
+        //   capacity : validate    ,  
+        //       
+        for (uint64_t probe = 0; probe < capacity && states[index]; probe++) {
+            if (slots[index].key == key) {
+                return (int64_t)index;
+            }
+            index = (index + 1) & mask;
+        }
+        return -1;
+    }
+
+    void validate(const std::string& path) {
+        const SnapshotFormat::Header* header = (const SnapshotFormat::Header*)file.bytes();
+        if (file.size() < SnapshotFormat::HEADER_SIZE
+            || std::memcmp(header->magic, SnapshotFormat::MAGIC, sizeof(SnapshotFormat::MAGIC)) != 0) {
+            throw std::runtime_error("Not a HashTable snapshot: " + path);
+        }
+        if (header->version != SnapshotFormat::VERSION || header->byteOrder != SnapshotFormat::ENDIAN_CHECK) {
+            throw std::runtime_error("Unsupported HashTable snapshot version or byte order: " + path);
+        }
+        if (header->keySize != sizeof(Key) || header->valueSize != sizeof(Value) || header->slotSize != sizeof(Slot)) {
+            throw std::runtime_error("HashTable snapshot key or value type does not match: " + path);
+        }
+        if (header->hashCheck != (uint64_t)hashFunc(Key())) {
+            throw std::runtime_error("HashTable snapshot was saved with another hash function: " + path);
+        }
+        uint64_t cap = header->capacity;
+        if (cap < 8 || (cap & (cap - 1)) != 0 || header->count >= cap
+            || header->fileSize != file.size()
+            || header->statesOffset < SnapshotFormat::HEADER_SIZE
+            || header->statesOffset + cap > header->slotsOffset
+            || header->slotsOffset % SnapshotFormat::ALIGNMENT != 0
+            || header->slotsOffset + cap * sizeof(Slot) > file.size()) {
+            throw std::runtime_error("Corrupted HashTable snapshot: " + path);
+        }
+    }
+
+public:
+    //  ;  std::runtime_error,    
+    explicit MappedHashTable(const std::string& path) : file(path), hashFunc(HashFunc()) {
+        validate(path);
+        const SnapshotFormat::Header* header = (const SnapshotFormat::Header*)file.bytes();
+        capacity = header->capacity;
+        count = header->count;
+        shift = shiftFor(capacity);
+        states = file.bytes() + header->statesOffset;
+        slots = (Slot*)(file.bytes() + header->slotsOffset);
+    }
+
+    //      
+    static void save(const IDictionary<Key, Value>& dict, const std::string& path) {
+        DynamicArray<Slot> pairs;
+        dict.getAllPairs(pairs);
+        uint64_t n = (uint64_t)pairs.GetLength();
+
+        //    0.7,      
+        uint64_t cap = 8;
+        while (n * 10 > cap * 7) {
+            cap *= 2;
+        }
+        int shift = shiftFor(cap);
+
+        SnapshotFormat::Header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, SnapshotFormat::MAGIC, sizeof(header.magic));
+        header.version = SnapshotFormat::VERSION;
+        header.byteOrder = SnapshotFormat::ENDIAN_CHECK;
+        header.keySize = sizeof(Key);
+        header.valueSize = sizeof(Value);
+        header.slotSize = sizeof(Slot);
+        header.capacity = cap;
+        header.count = n;
+        header.hashCheck = (uint64_t)HashFunc()(Key());
+        header.statesOffset = SnapshotFormat::HEADER_SIZE;
+        header.slotsOffset = SnapshotFormat::alignUp(header.statesOffset + cap);
+        header.fileSize = header.slotsOffset + cap * sizeof(Slot);
+
+        //  ,      
+        unsigned char* buffer = new unsigned char[(size_t)header.fileSize]();
+        std::memcpy(buffer, &header, sizeof(header));
+        uint8_t* bufferStates = buffer + header.statesOffset;
+        unsigned char* bufferSlots = buffer + header.slotsOffset;
+
+        HashFunc hashFunc;
+        for (uint64_t i = 0; i < n; i++) {
+            const Slot& pair = pairs.GetElem((int)i);
+            uint64_t index = SnapshotFormat::home(hashFunc(pair.key), shift);
+            while (bufferStates[index]) {
+                index = (index + 1) & (cap - 1);
+            }
+            bufferStates[index] = 1;
+            unsigned char* slot = bufferSlots + index * sizeof(Slot);
+            std::memcpy(slot + offsetof(Slot, key), &pair.key, sizeof(Key));
+            std::memcpy(slot + offsetof(Slot, value), &pair.value, sizeof(Value));
+        }
+
+        std::FILE* out = std::fopen(path.c_str(), "wb");
+        if (!out) {
+            delete[] buffer;
+            throw std::runtime_error("Cannot create snapshot file: " + path);
+        }
+        size_t written = std::fwrite(buffer, 1, (size_t)header.fileSize, out);
+        int closed = std::fclose(out);
+        delete[] buffer;
+        if (written != (size_t)header.fileSize || closed != 0) {
+            throw std::runtime_error("Cannot write snapshot file: " + path);
+        }
+    }
+
+    void insert(const Key&, const Value&) override {
+        throw std::runtime_error("MappedHashTable is read-only.");
+    }
+
+    Pair<Value*, bool> tryEmplace(const Key&, const Value&) override {
+        throw std::runtime_error("MappedHashTable is read-only.");
+    }
+
+    bool remove(const Key&) override {
+        throw std::runtime_error("MappedHashTable is read-only.");
+    }
+
+    //         
+    Value* find(const Key& key) override {
+        int64_t index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    const Value* find(const Key& key) const override {
+        int64_t index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    bool exist(const Key& key) const override {
+        return findIndex(key) >= 0;
+    }
+
+    Value get(const Key& key) const override {
+        int64_t index = findIndex(key);
+        if (index < 0) {
+            throw std::runtime_error("Key not found in MappedHashTable.");
+        }
+        return slots[index].value;
+    }
+
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + (int)count);
+        for (uint64_t i = 0; i < capacity; i++) {
+            if (states[i]) {
+                arr.EmplaceBack(slots[i]);
+            }
+        }
+    }
+
+    //  
+    int size() const {
+        return (int)count;
+    }
+
+    //  
+    int getCapacity() const {
+        return (int)capacity;
+    }
+};
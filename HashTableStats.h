@@ -0,0 +1,93 @@
+// HashTableStats.h
+#pragma once
+
+#include <string>
+
+//   -
+struct HashTableStatsSnapshot {
+    //    : 1, 2, 3, 4, 5-8, 9-16, 17-32, 33+
+    static const int PROBE_BUCKETS = 8;
+
+    long long operations;                 //    (, , )
+    long long probeCounts[PROBE_BUCKETS]; //     
+    long long totalProbes;                //     
+    int maxProbeLength;                   //      
+    long long rehashCount;                //   (   )
+    long long rehashNanoseconds;          // ,   
+    int tombstones;                       //   (DELETED)  
+    int size;                             //  
+    int capacity;                         // 
+
+    HashTableStatsSnapshot()
+        : operations(0), totalProbes(0), maxProbeLength(0), rehashCount(0),
+        rehashNanoseconds(0), tombstones(0), size(0), capacity(0) {
+        for (int i = 0; i < PROBE_BUCKETS; i++) {
+            probeCounts[i] = 0;
+        }
+    }
+
+    double averageProbes() const {
+        return operations ? (double)totalProbes / operations : 0.0;
+    }
+
+    //     
+    static int bucketOf(int probes) {
+        if (probes <= 4) return probes <= 1 ? 0 : probes - 1;
+        if (probes <= 8) return 4;
+        if (probes <= 16) return 5;
+        if (probes <= 32) return 6;
+        return 7;
+    }
+
+    static const char* bucketName(int bucket) {
+        static const char* names[PROBE_BUCKETS] = { "1", "2", "3", "4", "5-8", "9-16", "17-32", "33+" };
+        return names[bucket];
+    }
+};
+
+//    HashTable.   enabled = false   ,
+//    ,      .
+
+//   ( )
+struct NoHashTableStats {
+    static const bool enabled = false;
+
+    void recordProbes(int) {}
+    void recordRehash(long long) {}
+    void recordRehashTime(long long) {}
+    void fill(HashTableStatsSnapshot&) const {}
+};
+
+//  ,    
+struct HashTableStats {
+    static const bool enabled = true;
+
+    HashTableStatsSnapshot data;
+
+    void recordProbes(int probes) {
+        data.operations++;
+        data.totalProbes += probes;
+        data.probeCounts[HashTableStatsSnapshot::bucketOf(probes)]++;
+        if (probes > data.maxProbeLength) {
+            data.maxProbeLength = probes;
+        }
+    }
+
+    //     
+    void recordRehash(long long nanoseconds) {
+        data.rehashCount++;
+        data.rehashNanoseconds += nanoseconds;
+    }
+
+    //   ,    
+    void recordRehashTime(long long nanoseconds) {
+        data.rehashNanoseconds += nanoseconds;
+    }
+
+    void fill(HashTableStatsSnapshot& snapshot) const {
+        snapshot = data;
+    }
+};
+
+//    - (    )
+typedef void (*HashTableLogSink)(const std::string& message);
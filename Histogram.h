@@ -1,8 +1,13 @@
 #pragma once
 #include "IDictionary.h"
+#include "IOrderedDictionary.h"
+#include "BalanceBinaryTree.h"
 #include "DynamicArray.h"
+#include "Sort.h"
 #include "Pair.h"
 #include <stdexcept>
+#include <limits>
+#include <climits>
 
 //  ,    T (, Person)  double:
 template <typename T>
@@ -37,7 +42,7 @@ public:
         ExtractDoubleFunc<T> extractorFunc)
         : dictionary(dict), minVal(minVal), maxVal(maxVal), numBins(numBins), extractor(extractorFunc) {}
 
-    void buildHistogram(const DynamicArray<T>& data) {
+    void buildHistogram(ArrayView<const T> data) {
         //    ( )     
         //     ,    .
 
@@ -53,10 +58,36 @@ public:
                 : (minVal + (i + 1) * range);
             dictionary->insert(bin, 0);
         }
+        addData(data);
+    }
+
+    //   data  ,  buildHistogram,   .
+    //   ShardedHashTable     
+    void addData(ArrayView<const T> data) {
+        double range = (maxVal - minVal) / numBins;
+
+        //        O(log numBins)
+        const IOrderedDictionary<Pair<KeyType, KeyType>, int>* ordered =
+            dynamic_cast<const IOrderedDictionary<Pair<KeyType, KeyType>, int>*>(dictionary);
 
         //  
-        for (int i = 0; i < data.GetLength(); i++) {
-            double val = extractor(data.GetElem(i));
+        for (const T& item : data) {
+            double val = extractor(item);
+            if (ordered) {
+                //      < val;    ,   
+                // ,    .   , val  
+                //     
+                Pair<KeyType, KeyType> probe((KeyType)val, std::numeric_limits<KeyType>::lowest());
+                const Pair<Pair<KeyType, KeyType>, int>* bin = ordered->floor(probe);
+                if (!bin || val > bin->key.value) {
+                    bin = ordered->lowerBound(probe);
+                }
+                if (bin && val >= bin->key.key && val <= bin->key.value) {
+                    dictionary->upsert(bin->key, [](int& count) { count++; });
+                }
+                continue;
+            }
+
             // ,     val
             //    
             // (   [low, high),  ,  )
@@ -68,8 +99,7 @@ public:
                     : (minVal + (b + 1) * range);
 
                 if (val >= bin.key && val <= bin.value) {
-                    int currentCount = dictionary->get(bin);
-                    dictionary->insert(bin, currentCount + 1);
+                    dictionary->upsert(bin, [](int& count) { count++; });
                     break;
                 }
             }
@@ -93,6 +123,12 @@ private:
     int elementsPerBin; //     
     ExtractDoubleFunc<T> extractor;
 
+    //  :     (  )
+    //       ,   updateBins
+    BalanceBinaryTree<Pair<double, int>, char, NewDeleteAllocator, true> values;
+    int nextValueId;
+    DynamicArray<Pair<KeyType, KeyType>> streamBins;
+
 public:
     //  :
     // 1)  (BalancedBinaryTree  HashTable)
@@ -101,9 +137,55 @@ public:
     FloatingHistogram(IDictionary<Pair<KeyType, KeyType>, int>* dict,
         int elementsPerBin,
         ExtractDoubleFunc<T> extractorFunc)
-        : dictionary(dict), elementsPerBin(elementsPerBin), extractor(extractorFunc) {}
+        : dictionary(dict), elementsPerBin(elementsPerBin), extractor(extractorFunc), nextValueId(0) {}
+
+    //     ;     updateBins
+    void addValue(const T& item) {
+        values.insert(Pair<double, int>(extractor(item), nextValueId++), 0);
+    }
+
+    //   ,  extractor(item); false,   
+    bool removeValue(const T& item) {
+        double val = extractor(item);
+        const Pair<Pair<double, int>, char>* found = values.lowerBound(Pair<double, int>(val, INT_MIN));
+        if (!found || found->key.key != val) {
+            return false;
+        }
+        Pair<double, int> key = found->key;
+        return values.remove(key);
+    }
 
-    void buildHistogram(const DynamicArray<T>& data) {
+    int valueCount() const {
+        return values.size();
+    }
+
+    //         : 
+    //  - select   , O(  * log n).  
+    // updateBins   
+    void updateBins() {
+        if (elementsPerBin <= 0) {
+            throw std::runtime_error("Number of elements per bin must be positive");
+        }
+        for (int i = 0; i < streamBins.GetLength(); i++) {
+            dictionary->remove(streamBins.GetElem(i));
+        }
+        streamBins.Clear();
+
+        int numBins = values.size() / elementsPerBin;
+        int remainder = values.size() % elementsPerBin;
+        int startIndex = 0;
+        for (int b = 0; b < numBins; b++) {
+            int currentBinCount = elementsPerBin + (b == numBins - 1 ? remainder : 0);
+            Pair<KeyType, KeyType> bin((KeyType)values.select(startIndex).key.key,
+                (KeyType)values.select(startIndex + currentBinCount - 1).key.key);
+            //     ,   
+            dictionary->upsert(bin, [currentBinCount](int& count) { count += currentBinCount; });
+            streamBins.Append(bin);
+            startIndex += currentBinCount;
+        }
+    }
+
+    void buildHistogram(ArrayView<const T> data) {
         if (elementsPerBin <= 0) {
             throw std::runtime_error("Number of elements per bin must be positive");
         }
@@ -111,16 +193,13 @@ public:
             return;
         }
 
-        //      extractor,       
-        DynamicArray<T> sortedData(data);
-        //      
-        for (int i = 0; i < sortedData.GetLength(); i++) {
-            for (int j = 0; j < sortedData.GetLength() - i - 1; j++) {
-                if (extractor(sortedData.GetElem(j)) > extractor(sortedData.GetElem(j + 1))) {
-                    sortedData.Swap(sortedData.GetElem(j), sortedData.GetElem(j + 1));
-                }
-            }
+        //      extractor:    
+        //     O(n),       
+        DynamicArray<double> sortedValues(data.GetLength());
+        for (const T& item : data) {
+            sortedValues.EmplaceBack(extractor(item));
         }
+        RadixSort(sortedValues);
 
         //   
         int numBins = data.GetLength() / elementsPerBin;
@@ -141,9 +220,9 @@ public:
             }
 
             //  
-            double lowVal = extractor(sortedData.GetElem(startIndex));
+            double lowVal = sortedValues.GetElem(startIndex);
             //  
-            double highVal = extractor(sortedData.GetElem(startIndex + currentBinCount - 1));
+            double highVal = sortedValues.GetElem(startIndex + currentBinCount - 1);
 
             //   [lowVal, highVal]
             Pair<KeyType, KeyType> bin(lowVal, highVal);
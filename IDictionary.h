@@ -1,10 +1,20 @@
 #pragma once
 #include "DynamicArray.h"
 #include "Pair.h"
+#include <functional>
 
 template <typename Key, typename Value>
 class IDictionary {
+private:
+    // upsert    update    (ShardedHashTable).
+    //  ,    :    upsert  
+    bool lockedUpdate;
+
+protected:
+    explicit IDictionary(bool lockedUpdate) : lockedUpdate(lockedUpdate) {}
+
 public:
+    IDictionary() : lockedUpdate(false) {}
     virtual ~IDictionary() {}
 
     virtual void insert(const Key& key, const Value& value) = 0;
@@ -12,6 +22,73 @@ public:
     virtual Value get(const Key& key) const = 0;
     virtual bool remove(const Key& key) = 0;
 
+    //       nullptr,   .
+    //      
+    virtual Value* find(const Key& key) = 0;
+    virtual const Value* find(const Key& key) const = 0;
+
+    // ,     .      
+    //  true,     (false,    )
+    virtual Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) = 0;
+
+    //      out   ; false,   .
+    //    find,     
+    virtual bool tryGet(const Key& key, Value& out) const {
+        const Value* value = find(key);
+        if (!value) {
+            return false;
+        }
+        out = *value;
+        return true;
+    }
+
+    //     ;     Value().
+    //   , . lockedUpdate
+    virtual void update(const Key& key, const std::function<void(Value&)>& func) {
+        func(*tryEmplace(key, Value()).key);
+    }
+
+    //       ;     Value().
+    //    func     tryEmplace,  std::function.
+    //    :     
+    //   
+    template <typename UpdateFunc>
+    Value upsert(const Key& key, UpdateFunc func) {
+        if (lockedUpdate) {
+            Value result = Value();
+            update(key, [&func, &result](Value& value) {
+                func(value);
+                result = value;
+            });
+            return result;
+        }
+        Value* value = tryEmplace(key, Value()).key;
+        func(*value);
+        return *value;
+    }
+
+    //  .   -   ;  
+    //    (. HashTable)
+    virtual void insertBatch(ArrayView<const Pair<Key, Value>> pairs) {
+        for (int i = 0; i < pairs.GetLength(); i++) {
+            insert(pairs.GetElem(i).key, pairs.GetElem(i).value);
+        }
+    }
+
+    // result[i] -   keys[i];     result
+    virtual void existBatch(ArrayView<const Key> keys, DynamicArray<bool>& result) const {
+        for (int i = 0; i < keys.GetLength(); i++) {
+            result.Append(exist(keys.GetElem(i)));
+        }
+    }
+
+    // result[i] -  keys[i];   get,     
+    virtual void getBatch(ArrayView<const Key> keys, DynamicArray<Value>& result) const {
+        for (int i = 0; i < keys.GetLength(); i++) {
+            result.Append(get(keys.GetElem(i)));
+        }
+    }
+
     //    (key-value),    , ,  
     virtual void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const = 0;
 };
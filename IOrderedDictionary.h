@@ -0,0 +1,41 @@
+#pragma once
+#include "IDictionary.h"
+#include "DynamicArray.h"
+#include "Pair.h"
+
+// ,      (BalanceBinaryTree).
+//          nullptr,  ;
+//      
+template <typename Key, typename Value>
+class IOrderedDictionary : public IDictionary<Key, Value> {
+public:
+    //    ; context -  
+    typedef void (*RangeVisitor)(const Pair<Key, Value>& pair, void* context);
+
+    //     >= key
+    virtual const Pair<Key, Value>* lowerBound(const Key& key) const = 0;
+    //     > key
+    virtual const Pair<Key, Value>* upperBound(const Key& key) const = 0;
+    //     <= key
+    virtual const Pair<Key, Value>* floor(const Key& key) const = 0;
+    //     >= key ( ,  lowerBound)
+    virtual const Pair<Key, Value>* ceil(const Key& key) const {
+        return lowerBound(key);
+    }
+
+    //      [lo, hi)   
+    virtual void visitRange(const Key& lo, const Key& hi, RangeVisitor visitor, void* context) const = 0;
+
+    //        visit(const Pair<Key, Value>&)
+    template <typename Visitor>
+    void forEachInRange(const Key& lo, const Key& hi, Visitor visit) const {
+        visitRange(lo, hi, [](const Pair<Key, Value>& pair, void* context) {
+            (*static_cast<Visitor*>(context))(pair);
+        }, &visit);
+    }
+
+    //    [lo, hi)   arr
+    void getRange(const Key& lo, const Key& hi, DynamicArray<Pair<Key, Value>>& arr) const {
+        forEachInRange(lo, hi, [&arr](const Pair<Key, Value>& pair) { arr.Append(pair); });
+    }
+};
@@ -133,7 +133,11 @@ void manageHistogram(IDictionary<Pair<double, double>, int>* dict, bool isFixed)
                 std::cout << "Data added to Fixed Histogram.\n";
             }
             else if (!isFixed && currentFloatingHistogram != nullptr) {
-                currentFloatingHistogram->buildHistogram(data);
+                //      ,     
+                for (int i = 0; i < data.GetLength(); i++) {
+                    currentFloatingHistogram->addValue(data.GetElem(i));
+                }
+                currentFloatingHistogram->updateBins();
                 std::cout << "Data added to Floating Histogram.\n";
             }
             else {
@@ -176,10 +180,10 @@ void manageHistogram(IDictionary<Pair<double, double>, int>* dict, bool isFixed)
                     continue;
                 }
                 Pair<double, double> bin(minVal + binIndex * range, minVal + (binIndex + 1) * range);
-                if (dict->exist(bin)) {
-                    int currentCount = dict->get(bin);
-                    if (currentCount > 0) {
-                        dict->insert(bin, currentCount - 1);
+                int* currentCount = dict->find(bin);
+                if (currentCount) {
+                    if (*currentCount > 0) {
+                        (*currentCount)--;
                         std::cout << "Value removed from bin [" << bin.key << ", " << bin.value << ")\n";
                     }
                     else {
@@ -191,8 +195,13 @@ void manageHistogram(IDictionary<Pair<double, double>, int>* dict, bool isFixed)
                 }
             }
             else if (!isFixed && currentFloatingHistogram != nullptr) {
-                //     FloatingHistogram
-                std::cout << "Removal for FloatingHistogram not implemented.\n";
+                if (currentFloatingHistogram->removeValue(value)) {
+                    currentFloatingHistogram->updateBins();
+                    std::cout << "Value removed, bins recomputed.\n";
+                }
+                else {
+                    std::cout << "Value not found.\n";
+                }
             }
             else {
                 std::cout << "Histogram not initialized correctly.\n";
@@ -226,6 +235,7 @@ void createSparseMatrix() {
     std::cout << "Select storage type:\n";
     std::cout << "1. HashTable\n";
     std::cout << "2. BalancedBinaryTree\n";
+    std::cout << "3. BPlusTree\n";
     std::cout << "Select: ";
     int storageChoice;
     std::cin >> storageChoice;
@@ -237,6 +247,9 @@ void createSparseMatrix() {
     else if (storageChoice == 2) {
         dict = new BalanceBinaryTree<Pair<int, int>, double>();
     }
+    else if (storageChoice == 3) {
+        dict = new BPlusTree<Pair<int, int>, double>();
+    }
     else {
         std::cout << "Invalid storage type. Returning to main menu.\n";
         return;
@@ -6,6 +6,7 @@
 #include <iomanip>
 
 #include "BalanceBinaryTree.h"
+#include "BPlusTree.h"
 #include "HashTable.h"
 #include "DynamicArray.h"
 #include "Person.h"
@@ -2,6 +2,8 @@
 #pragma once
 #include "Sequence.h"
 #include "DynamicArray.h"
+#include <iterator>
+#include <cstddef>
 // ,  Range 
 
 template <class T>
@@ -21,7 +23,91 @@ private:
     int length;
 
 public:
+    //   STL      .
+    // IsConst -   const T
+    template <bool IsConst>
+    class ListIterator {
+    private:
+        typedef typename std::conditional<IsConst, const Node*, Node*>::type NodePtr;
+        NodePtr current;
+
+        friend class LinkedList;
+        friend class ListIterator<!IsConst>;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename std::conditional<IsConst, const T&, T&>::type reference;
+
+        ListIterator() : current(nullptr) {}
+        explicit ListIterator(NodePtr node) : current(node) {}
+
+        // iterator -> const_iterator
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        ListIterator(const ListIterator<OtherConst>& other) : current(other.current) {}
+
+        reference operator*() const {
+            return current->data;
+        }
+
+        pointer operator->() const {
+            return &current->data;
+        }
+
+        ListIterator& operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        ListIterator operator++(int) {
+            ListIterator previous = *this;
+            current = current->next;
+            return previous;
+        }
+
+        //    ,    const_iterator  iterator
+        template <bool OtherConst>
+        bool operator==(const ListIterator<OtherConst>& other) const {
+            return current == other.current;
+        }
+
+        template <bool OtherConst>
+        bool operator!=(const ListIterator<OtherConst>& other) const {
+            return current != other.current;
+        }
+    };
+
+    typedef T value_type;
+    typedef ListIterator<false> iterator;
+    typedef ListIterator<true> const_iterator;
+
+    iterator begin() {
+        return iterator(head);
+    }
+
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator(head);
+    }
+
+    const_iterator cend() const {
+        return const_iterator(nullptr);
+    }
 
+    //   Sequence -      ToBegin/ToEnd
     class LinkedListIterator : public Sequence<T>::Iterator {
     private:
         Node* current;
@@ -191,12 +277,12 @@ public:
         b = temp;
     }
 
-    void Set(int index, T value) override
+    void Set(int index, T value)
     {
         GetNode(index)->data = value;
     }
 
-    LinkedList<T>* GetSubsequence(int startIndex, int endIndex) override
+    LinkedList<T>* GetSubsequence(int startIndex, int endIndex)
     {
         if (startIndex < 0 || endIndex >= length || startIndex > endIndex)
         {
@@ -2,7 +2,7 @@
 
 DynamicArray<double> generateRandomNumbers(double min, double max, int count) {
     DynamicArray<double> numbers;
-    numbers.Clear();
+    numbers.Reserve(count);
     for (int i = 0; i < count; ++i) {
         double num = min + static_cast<double>(rand()) / RAND_MAX * (max - min);
         numbers.Append(num);
@@ -19,7 +19,7 @@ struct TestResult {
 
 struct Structure {
     std::string name;
-    enum Type { BALANCED_BINARY_TREE, HASH_TABLE } type;
+    enum Type { BALANCED_BINARY_TREE, B_PLUS_TREE, HASH_TABLE, GROUP_HASH_TABLE, ROBIN_HOOD_HASH_TABLE } type;
 };
 
 struct Operation {
@@ -70,6 +70,1369 @@ void displayResults(const DynamicArray<TestResult>& allResults, const int testSi
     std::cout << "\nLoad tests completed.\n";
 }
 
+long long percentile(DynamicArray<long long>& sortedValues, double p) {
+    int index = static_cast<int>(p * (sortedValues.GetLength() - 1));
+    return sortedValues.GetElem(index);
+}
+
+void measureInsertLatency(const std::string& name, bool incrementalRehash, int count) {
+    HashTable<int, double> table(11, 0.75, incrementalRehash);
+    DynamicArray<long long> latencies(count);
+
+    for (int m = 0; m < count; m++) {
+        auto start = std::chrono::steady_clock::now();
+        table.insert(m, static_cast<double>(m));
+        auto end = std::chrono::steady_clock::now();
+        latencies.Append(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    long long* first = &latencies.GetElem(0);
+    std::sort(first, first + latencies.GetLength());
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << percentile(latencies, 0.5)
+        << std::left << std::setw(15) << percentile(latencies, 0.99)
+        << std::left << std::setw(15) << percentile(latencies, 0.999)
+        << std::left << std::setw(15) << percentile(latencies, 0.9999)
+        << std::left << std::setw(15) << latencies.GetLastElem() << "\n";
+}
+
+void runRehashLatencyTest() {
+    const int count = 200000;
+    std::cout << "\n=== HashTable insert latency, " << count << " inserts from capacity 11 (ns) ===\n";
+
+    std::cout << std::left << std::setw(25) << "Rehash mode"
+        << std::left << std::setw(15) << "p50"
+        << std::left << std::setw(15) << "p99"
+        << std::left << std::setw(15) << "p999"
+        << std::left << std::setw(15) << "p9999"
+        << std::left << std::setw(15) << "max" << "\n";
+    std::cout << std::string(25 + 15 * 5, '-') << "\n";
+
+    measureInsertLatency("Stop-the-world", false, count);
+    measureInsertLatency("Incremental", true, count);
+}
+
+//      :    
+//    .          
+void measureSparseMatrixChurn(const std::string& name, IDictionary<Pair<int, int>, double>* dict,
+    int liveCount, int churnSteps) {
+    SparseMatrix<double> matrix(dict, 1000, 1000);
+    DynamicArray<Pair<int, int>> live(liveCount);
+    for (int m = 0; m < liveCount; m++) {
+        Pair<int, int> coord(rand() % 1000, rand() % 1000);
+        live.Append(coord);
+        matrix.set(coord.key, coord.value, 1.0 + m % 100);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < churnSteps; m++) {
+        int j = rand() % liveCount;
+        Pair<int, int>& coord = live.GetElem(j);
+        matrix.set(coord.key, coord.value, 0.0);
+        coord = Pair<int, int>(rand() % 1000, rand() % 1000);
+        matrix.set(coord.key, coord.value, 1.0 + m % 100);
+    }
+    auto churnEnd = std::chrono::high_resolution_clock::now();
+
+    double checksum = 0.0;
+    for (int m = 0; m < liveCount; m++) {
+        const Pair<int, int>& coord = live.GetElem(m);
+        checksum += matrix.get(coord.key, coord.value);
+    }
+    auto lookupEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(churnEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(lookupEnd - churnEnd).count()
+        << (checksum > 0 ? "" : " (empty)") << "\n";
+}
+
+void runSparseMatrixChurnTest() {
+    const int liveCount = 20000;
+    const int churnSteps = 200000;
+    std::cout << "\n=== SparseMatrix churn: " << liveCount << " non-zeros, " << churnSteps
+        << " zero/set steps (ms) ===\n";
+
+    std::cout << std::left << std::setw(25) << "Structure"
+        << std::left << std::setw(15) << "Churn"
+        << std::left << std::setw(15) << "Lookup all" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    HashTable<Pair<int, int>, double> hashDict(200000, 0.5);
+    measureSparseMatrixChurn("HashTable", &hashDict, liveCount, churnSteps);
+    GroupHashTable<Pair<int, int>, double> groupDict;
+    measureSparseMatrixChurn("GroupHashTable", &groupDict, liveCount, churnSteps);
+    RobinHoodHashTable<Pair<int, int>, double> robinDict;
+    measureSparseMatrixChurn("RobinHoodHashTable", &robinDict, liveCount, churnSteps);
+    std::cout << "RobinHoodHashTable max probe length: " << robinDict.maxProbeLength() << "\n";
+}
+
+template <typename Table>
+void measureCapacityPolicy(const std::string& name, int count) {
+    Table table(11, 0.75);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < count; m++) {
+        table.insert(m * 7919, m);
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+
+    long long found = 0;
+    for (int m = 0; m < 2 * count; m++) {
+        if (table.exist(m * 7919)) {
+            found += table.get(m * 7919);
+        }
+    }
+    auto lookupEnd = std::chrono::high_resolution_clock::now();
+
+    for (int m = 0; m < count; m += 2) {
+        table.remove(m * 7919);
+    }
+    auto removeEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(lookupEnd - insertEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(removeEnd - lookupEnd).count()
+        << (found > 0 ? "" : " (empty)") << "\n";
+}
+
+void runCapacityPolicyTest() {
+    const int count = 1000000;
+    std::cout << "\n=== HashTable capacity policies, " << count << " int keys (ms) ===\n";
+
+    std::cout << std::left << std::setw(25) << "Capacity policy"
+        << std::left << std::setw(15) << "Insert"
+        << std::left << std::setw(15) << "Exist+Get"
+        << std::left << std::setw(15) << "Remove" << "\n";
+    std::cout << std::string(25 + 15 * 3, '-') << "\n";
+
+    measureCapacityPolicy<HashTable<int, int, DefaultHash<int>, PrimeCapacity>>("Prime", count);
+    measureCapacityPolicy<HashTable<int, int, DefaultHash<int>, PowerOfTwoCapacity>>("PowerOfTwo", count);
+}
+
+//  -  (XOR  )   ,    -  
+template <typename Key>
+struct LegacyPairHash {
+    size_t operator()(const Key& keyPair) const {
+        return std::hash<decltype(keyPair.key)>()(keyPair.key) ^ (std::hash<decltype(keyPair.value)>()(keyPair.value) << 1);
+    }
+
+    size_t second(const Key& keyPair) const {
+        return (*this)(keyPair);
+    }
+};
+
+template <typename Key, typename Hash>
+void reportProbeLengths(const std::string& keySet, const std::string& hashName, const DynamicArray<Key>& keys) {
+    HashTable<Key, int, Hash> table(11, 0.75);
+    for (int i = 0; i < keys.GetLength(); i++) {
+        table.insert(keys.GetElem(i), i);
+    }
+
+    DynamicArray<int> histogram;
+    table.probeLengthHistogram(histogram);
+
+    long long totalProbes = 0;
+    int shortProbes = 0;
+    for (int probes = 1; probes < histogram.GetLength(); probes++) {
+        totalProbes += static_cast<long long>(probes) * histogram.GetElem(probes);
+        if (probes <= 2) {
+            shortProbes += histogram.GetElem(probes);
+        }
+    }
+
+    std::cout << std::left << std::setw(25) << keySet
+        << std::left << std::setw(15) << hashName
+        << std::left << std::setw(10) << table.size()
+        << std::left << std::setw(15) << std::fixed << std::setprecision(2)
+        << static_cast<double>(totalProbes) / table.size()
+        << std::left << std::setw(15) << histogram.GetLength() - 1
+        << std::left << std::setw(15) << 100.0 * shortProbes / table.size()
+        << "\n" << std::defaultfloat;
+}
+
+void runHashDiagnostics() {
+    std::cout << "\n=== HashTable probe length distribution ===\n";
+    std::cout << std::left << std::setw(25) << "Key set"
+        << std::left << std::setw(15) << "Hash"
+        << std::left << std::setw(10) << "Keys"
+        << std::left << std::setw(15) << "Mean probes"
+        << std::left << std::setw(15) << "Max probes"
+        << std::left << std::setw(15) << "<= 2 probes, %" << "\n";
+    std::cout << std::string(25 + 15 + 10 + 15 * 3, '-') << "\n";
+
+    DynamicArray<Pair<int, int>> randomCells;
+    for (int m = 0; m < 20000; m++) {
+        randomCells.Append(Pair<int, int>(rand() % 1000, rand() % 1000));
+    }
+    DynamicArray<Pair<int, int>> bandCells;
+    for (int r = 0; r < 1000; r++) {
+        for (int c = r - 10; c <= r + 10; c++) {
+            if (c >= 0 && c < 1000) {
+                bandCells.Append(Pair<int, int>(r, c));
+            }
+        }
+    }
+    DynamicArray<Pair<double, double>> bins;
+    const int numBins = 5000;
+    const double range = 100.0 / numBins;
+    for (int b = 0; b < numBins; b++) {
+        bins.Append(Pair<double, double>(b * range, (b + 1) * range));
+    }
+
+    reportProbeLengths<Pair<int, int>, LegacyPairHash<Pair<int, int>>>("SparseMatrix random", "Legacy XOR", randomCells);
+    reportProbeLengths<Pair<int, int>, DefaultHash<Pair<int, int>>>("SparseMatrix random", "DefaultHash", randomCells);
+    reportProbeLengths<Pair<int, int>, LegacyPairHash<Pair<int, int>>>("SparseMatrix band", "Legacy XOR", bandCells);
+    reportProbeLengths<Pair<int, int>, DefaultHash<Pair<int, int>>>("SparseMatrix band", "DefaultHash", bandCells);
+    reportProbeLengths<Pair<double, double>, LegacyPairHash<Pair<double, double>>>("Histogram bins", "Legacy XOR", bins);
+    reportProbeLengths<Pair<double, double>, DefaultHash<Pair<double, double>>>("Histogram bins", "DefaultHash", bins);
+}
+
+//   :   xorshift,   rand()  
+void fillSparseMatrixPart(SparseMatrix<double>* matrix, std::mutex* externalLock, unsigned int seed, int count) {
+    unsigned int state = seed * 2654435761u + 1;
+    for (int m = 0; m < count; m++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int r = static_cast<int>(state % 1000);
+        int c = static_cast<int>((state / 1000) % 1000);
+        double val = 1.0 + (state % 1000) / 10.0;
+        if (externalLock) {
+            std::lock_guard<std::mutex> lock(*externalLock);
+            matrix->set(r, c, val);
+        }
+        else {
+            matrix->set(r, c, val);
+        }
+    }
+}
+
+long long measureConcurrentSet(IDictionary<Pair<int, int>, double>* dict, std::mutex* externalLock,
+    int threadCount, int totalSets) {
+    SparseMatrix<double> matrix(dict, 1000, 1000);
+    DynamicArray<std::thread*> threads(threadCount);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threadCount; t++) {
+        threads.Append(new std::thread(fillSparseMatrixPart, &matrix, externalLock, t + 1u, totalSets / threadCount));
+    }
+    for (int t = 0; t < threadCount; t++) {
+        threads.GetElem(t)->join();
+        delete threads.GetElem(t);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void runConcurrentIngestionTest() {
+    const int totalSets = 2000000;
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads <= 0) {
+        maxThreads = 1;
+    }
+    std::cout << "\n=== Concurrent SparseMatrix::set, " << totalSets << " sets, "
+        << maxThreads << " hardware threads (ms) ===\n";
+
+    std::cout << std::left << std::setw(10) << "Threads"
+        << std::left << std::setw(25) << "HashTable + mutex"
+        << std::left << std::setw(25) << "ShardedHashTable" << "\n";
+    std::cout << std::string(10 + 25 * 2, '-') << "\n";
+
+    for (int threadCount = 1; ; threadCount *= 2) {
+        if (threadCount > maxThreads) {
+            threadCount = maxThreads;
+        }
+
+        HashTable<Pair<int, int>, double> lockedDict(2 * totalSets, 0.75);
+        std::mutex externalLock;
+        long long lockedMs = measureConcurrentSet(&lockedDict, &externalLock, threadCount, totalSets);
+
+        ShardedHashTable<Pair<int, int>, double> shardedDict(64, 2 * totalSets / 64, 0.75);
+        long long shardedMs = measureConcurrentSet(&shardedDict, nullptr, threadCount, totalSets);
+
+        std::cout << std::left << std::setw(10) << threadCount
+            << std::left << std::setw(25) << lockedMs
+            << std::left << std::setw(25) << shardedMs << "\n";
+
+        if (threadCount == maxThreads) {
+            break;
+        }
+    }
+}
+
+void runSparseMatrixBulkBuildTest() {
+    const int count = 1000000;
+    std::cout << "\n=== SparseMatrix bulk build, " << count << " elements into 10000x10000 (ms) ===\n";
+
+    DynamicArray<Pair<Pair<int, int>, double>> elements(count);
+    for (int m = 0; m < count; m++) {
+        Pair<int, int> coord(rand() % 10000, rand() % 10000);
+        elements.Append(Pair<Pair<int, int>, double>(coord, 1.0 + m % 100));
+    }
+
+    std::cout << std::left << std::setw(35) << "Method"
+        << std::left << std::setw(15) << "Time" << "\n";
+    std::cout << std::string(35 + 15, '-') << "\n";
+
+    {
+        HashTable<Pair<int, int>, double> dict;
+        SparseMatrix<double> matrix(&dict, 10000, 10000);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int m = 0; m < count; m++) {
+            const Pair<Pair<int, int>, double>& e = elements.GetElem(m);
+            matrix.set(e.key.key, e.key.value, e.value);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << std::left << std::setw(35) << "set() one by one"
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "\n";
+    }
+    {
+        HashTable<Pair<int, int>, double> dict;
+        dict.reserve(count);
+        SparseMatrix<double> matrix(&dict, 10000, 10000);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int m = 0; m < count; m++) {
+            const Pair<Pair<int, int>, double>& e = elements.GetElem(m);
+            matrix.set(e.key.key, e.key.value, e.value);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << std::left << std::setw(35) << "reserve() + set() one by one"
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "\n";
+    }
+    {
+        HashTable<Pair<int, int>, double> dict;
+        SparseMatrix<double> matrix(&dict, 10000, 10000);
+        auto start = std::chrono::high_resolution_clock::now();
+        matrix.setBatch(elements);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << std::left << std::setw(35) << "setBatch() (reserve + prefetch)"
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "\n";
+    }
+}
+
+void runHashTableStatsReport() {
+    const int liveCount = 20000;
+    const int churnSteps = 200000;
+    std::cout << "\n=== HashTable statistics: SparseMatrix churn, " << liveCount << " non-zeros, " << churnSteps
+        << " zero/set steps (ms) ===\n";
+
+    std::cout << std::left << std::setw(25) << "Stats policy"
+        << std::left << std::setw(15) << "Churn"
+        << std::left << std::setw(15) << "Lookup all" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    HashTable<Pair<int, int>, double> plainDict(11, 0.75);
+    measureSparseMatrixChurn("NoHashTableStats", &plainDict, liveCount, churnSteps);
+    HashTable<Pair<int, int>, double, DefaultHash<Pair<int, int>>, PrimeCapacity, HashTableStats> statsDict(11, 0.75);
+    measureSparseMatrixChurn("HashTableStats", &statsDict, liveCount, churnSteps);
+
+    HashTableStatsSnapshot snapshot = statsDict.stats();
+    std::cout << "Operations: " << snapshot.operations
+        << ", mean probes: " << std::fixed << std::setprecision(2) << snapshot.averageProbes() << std::defaultfloat
+        << ", max probes: " << snapshot.maxProbeLength
+        << ", tombstones: " << snapshot.tombstones << " of " << snapshot.capacity
+        << ", rehashes: " << snapshot.rehashCount
+        << " (" << snapshot.rehashNanoseconds / 1000 << " us)\n";
+    std::cout << "Probe histogram:";
+    for (int b = 0; b < HashTableStatsSnapshot::PROBE_BUCKETS; b++) {
+        std::cout << " [" << HashTableStatsSnapshot::bucketName(b) << "] " << snapshot.probeCounts[b];
+    }
+    std::cout << "\n";
+}
+
+void runSnapshotTest() {
+    const int count = 1000000;
+    const int side = 5000;
+    const std::string path = "load_test_matrix.snapshot";
+    std::cout << "\n=== SparseMatrix restart: " << count << " non-zeros, rebuild vs mmap snapshot (ms) ===\n";
+
+    DynamicArray<Pair<Pair<int, int>, double>> elements(count);
+    for (int m = 0; m < count; m++) {
+        elements.Append(Pair<Pair<int, int>, double>(Pair<int, int>(rand() % side, rand() % side), 1.0 + m % 100));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    HashTable<Pair<int, int>, double> rebuilt(11, 0.75);
+    SparseMatrix<double> rebuiltMatrix(&rebuilt, side, side);
+    for (int m = 0; m < count; m++) {
+        const Pair<Pair<int, int>, double>& element = elements.GetElem(m);
+        rebuiltMatrix.set(element.key.key, element.key.value, element.value);
+    }
+    auto rebuildEnd = std::chrono::high_resolution_clock::now();
+
+    MappedHashTable<Pair<int, int>, double>::save(rebuilt, path);
+    auto saveEnd = std::chrono::high_resolution_clock::now();
+
+    MappedHashTable<Pair<int, int>, double> mapped(path);
+    SparseMatrix<double> mappedMatrix(&mapped, side, side);
+    auto openEnd = std::chrono::high_resolution_clock::now();
+
+    double checksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        const Pair<int, int>& coord = elements.GetElem(m).key;
+        checksum += rebuiltMatrix.get(coord.key, coord.value);
+    }
+    auto rebuiltLookupEnd = std::chrono::high_resolution_clock::now();
+
+    double mappedChecksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        const Pair<int, int>& coord = elements.GetElem(m).key;
+        mappedChecksum += mappedMatrix.get(coord.key, coord.value);
+    }
+    auto mappedLookupEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << "Rebuild by insert"
+        << std::chrono::duration_cast<std::chrono::milliseconds>(rebuildEnd - start).count() << "\n";
+    std::cout << std::left << std::setw(25) << "Save snapshot"
+        << std::chrono::duration_cast<std::chrono::milliseconds>(saveEnd - rebuildEnd).count() << "\n";
+    std::cout << std::left << std::setw(25) << "Open mapped snapshot"
+        << std::chrono::duration_cast<std::chrono::microseconds>(openEnd - saveEnd).count() / 1000.0 << "\n";
+    std::cout << std::left << std::setw(25) << "Lookup all (HashTable)"
+        << std::chrono::duration_cast<std::chrono::milliseconds>(rebuiltLookupEnd - openEnd).count() << "\n";
+    std::cout << std::left << std::setw(25) << "Lookup all (mapped)"
+        << std::chrono::duration_cast<std::chrono::milliseconds>(mappedLookupEnd - rebuiltLookupEnd).count()
+        << (checksum == mappedChecksum ? "" : " (mismatch)") << "\n";
+
+    std::remove(path.c_str());
+}
+
+template <typename Table>
+void measureSparseMatrixMemory(const std::string& name, int count) {
+    Table dict(11, 0.75);
+    SparseMatrix<double> matrix(&dict, 5000, 5000);
+
+    srand(42);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < count; m++) {
+        matrix.set(rand() % 5000, rand() % 5000, 1.0 + m % 100);
+    }
+    auto setEnd = std::chrono::high_resolution_clock::now();
+
+    srand(42);
+    double checksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        int r = rand() % 5000;
+        int c = rand() % 5000;
+        checksum += matrix.get(r, c);
+    }
+    auto getEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << dict.size()
+        << std::left << std::setw(15) << dict.memoryUsage() / (1024 * 1024)
+        << std::left << std::setw(15) << std::fixed << std::setprecision(1)
+        << static_cast<double>(dict.memoryUsage()) / dict.size() << std::defaultfloat
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(setEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(getEnd - setEnd).count()
+        << (checksum > 0 ? "" : " (empty)") << "\n";
+}
+
+void runSparseMatrixMemoryTest() {
+    const int count = 1000000;
+    std::cout << "\n=== SparseMatrix<double> on HashTable, " << count << " sets: memory per non-zero ===\n";
+    std::cout << std::left << std::setw(25) << "Entry layout"
+        << std::left << std::setw(15) << "Non-zeros"
+        << std::left << std::setw(15) << "Table, MB"
+        << std::left << std::setw(15) << "Bytes/nnz"
+        << std::left << std::setw(15) << "Set, ms"
+        << std::left << std::setw(15) << "Get, ms" << "\n";
+    std::cout << std::string(25 + 15 * 5, '-') << "\n";
+
+    measureSparseMatrixMemory<HashTable<Pair<int, int>, double, DefaultHash<Pair<int, int>>, PrimeCapacity,
+        NoHashTableStats, HashEntry<Pair<int, int>, double, false>>>("Pair + status (" +
+            std::to_string(sizeof(HashEntry<Pair<int, int>, double, false>)) + " B)", count);
+    measureSparseMatrixMemory<HashTable<Pair<int, int>, double>>("Packed uint64_t (" +
+        std::to_string(sizeof(HashEntry<Pair<int, int>, double>)) + " B)", count);
+}
+
+template <typename Table, typename Key>
+void measureCachedHash(const std::string& name, const DynamicArray<Key>& keys) {
+    Table table(11, 0.75);
+    int n = keys.GetLength() / 2;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < n; m++) {
+        table.insert(keys.GetElem(m), m);
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+
+    //   :     
+    long long found = 0;
+    for (int m = 0; m < keys.GetLength(); m++) {
+        const int* value = table.find(keys.GetElem(m));
+        if (value) {
+            found += *value;
+        }
+    }
+    auto lookupEnd = std::chrono::high_resolution_clock::now();
+
+    HashTableStatsSnapshot snapshot = table.stats();
+    std::cout << std::left << std::setw(30) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+        << std::left << std::setw(15) << snapshot.rehashNanoseconds / 1000000
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(lookupEnd - insertEnd).count()
+        << (found > 0 ? "" : " (empty)") << "\n";
+}
+
+void runCachedHashTest() {
+    const int count = 500000;
+    std::cout << "\n=== HashTable with cached hashes, " << count << " inserts, " << 2 * count
+        << " lookups (ms) ===\n";
+    std::cout << std::left << std::setw(30) << "Keys / entry"
+        << std::left << std::setw(15) << "Insert"
+        << std::left << std::setw(15) << "of it rehash"
+        << std::left << std::setw(15) << "Lookup" << "\n";
+    std::cout << std::string(30 + 15 * 3, '-') << "\n";
+
+    typedef Pair<double, double> Bin;
+    DynamicArray<Bin> bins(2 * count);
+    const double range = 100.0 / (2 * count);
+    for (int b = 0; b < 2 * count; b++) {
+        bins.Append(Bin(b * range, (b + 1) * range));
+    }
+    for (int b = bins.GetLength() - 1; b > 0; b--) {
+        std::swap(bins[b], bins[rand() % (b + 1)]);
+    }
+    measureCachedHash<HashTable<Bin, int, DefaultHash<Bin>, PrimeCapacity, HashTableStats>>(
+        "Pair<double,double> / plain", bins);
+    measureCachedHash<HashTable<Bin, int, DefaultHash<Bin>, PrimeCapacity, HashTableStats, CachedHashEntry<Bin, int>>>(
+        "Pair<double,double> / cached", bins);
+
+    DynamicArray<std::string> names(2 * count);
+    for (int m = 0; m < 2 * count; m++) {
+        names.Append("histogram/bin/" + std::to_string(m) + "/value");
+    }
+    measureCachedHash<HashTable<std::string, int, DefaultHash<std::string>, PrimeCapacity, HashTableStats>>(
+        "std::string / plain", names);
+    measureCachedHash<HashTable<std::string, int, DefaultHash<std::string>, PrimeCapacity, HashTableStats,
+        CachedHashEntry<std::string, int>>>("std::string / cached", names);
+}
+
+template <typename Tree>
+void measureTreeAllocator(const std::string& name, int count) {
+    srand(7);
+    auto start = std::chrono::high_resolution_clock::now();
+    Tree* tree = new Tree();
+    SparseMatrix<double> matrix(tree, 5000, 5000);
+    for (int m = 0; m < count; m++) {
+        matrix.set(rand() % 5000, rand() % 5000, 1.0 + m % 100);
+    }
+    auto buildEnd = std::chrono::high_resolution_clock::now();
+
+    srand(7);
+    double checksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        int r = rand() % 5000;
+        int c = rand() % 5000;
+        checksum += matrix.get(r, c);
+    }
+    auto lookupEnd = std::chrono::high_resolution_clock::now();
+
+    delete tree;
+    auto destroyEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(buildEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(lookupEnd - buildEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::microseconds>(destroyEnd - lookupEnd).count() / 1000.0
+        << (checksum > 0 ? "" : " (empty)") << "\n";
+}
+
+void runTreeAllocatorTest() {
+    const int count = 1000000;
+    std::cout << "\n=== BalanceBinaryTree node allocation, SparseMatrix with " << count << " sets (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Allocator"
+        << std::left << std::setw(15) << "Build"
+        << std::left << std::setw(15) << "Lookup"
+        << std::left << std::setw(15) << "Destroy" << "\n";
+    std::cout << std::string(25 + 15 * 3, '-') << "\n";
+
+    measureTreeAllocator<BalanceBinaryTree<Pair<int, int>, double>>("NewDeleteAllocator", count);
+    measureTreeAllocator<BalanceBinaryTree<Pair<int, int>, double, NodePool>>("NodePool", count);
+}
+
+void runTreeLookupTest() {
+    const int count = 1000000;
+    std::cout << "\n=== BalanceBinaryTree paths, SparseMatrix with " << count << " sets (ms) ===\n";
+    std::cout << std::left << std::setw(15) << "Set"
+        << std::left << std::setw(15) << "Matrix get"
+        << std::left << std::setw(15) << "Tree get"
+        << std::left << std::setw(15) << "Tree exist"
+        << std::left << std::setw(15) << "Zero half"
+        << std::left << std::setw(15) << "All pairs" << "\n";
+    std::cout << std::string(15 * 6, '-') << "\n";
+
+    DynamicArray<Pair<int, int>> coords(count);
+    for (int m = 0; m < count; m++) {
+        coords.Append(Pair<int, int>(rand() % 5000, rand() % 5000));
+    }
+
+    BalanceBinaryTree<Pair<int, int>, double> tree;
+    SparseMatrix<double> matrix(&tree, 5000, 5000);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < count; m++) {
+        matrix.set(coords.GetElem(m).key, coords.GetElem(m).value, 1.0 + m % 100);
+    }
+    auto setEnd = std::chrono::high_resolution_clock::now();
+
+    double checksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        checksum += matrix.get(coords.GetElem(m).key, coords.GetElem(m).value);
+    }
+    auto matrixGetEnd = std::chrono::high_resolution_clock::now();
+
+    for (int m = 0; m < count; m++) {
+        checksum += tree.get(coords.GetElem(m));
+    }
+    auto treeGetEnd = std::chrono::high_resolution_clock::now();
+
+    int found = 0;
+    for (int m = 0; m < count; m++) {
+        found += tree.exist(Pair<int, int>(coords.GetElem(m).value, coords.GetElem(m).key)) ? 1 : 0;
+    }
+    auto existEnd = std::chrono::high_resolution_clock::now();
+
+    for (int m = 0; m < count; m += 2) {
+        matrix.set(coords.GetElem(m).key, coords.GetElem(m).value, 0.0);
+    }
+    auto removeEnd = std::chrono::high_resolution_clock::now();
+
+    DynamicArray<Pair<Pair<int, int>, double>> pairs(count);
+    tree.getAllPairs(pairs);
+    auto allPairsEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(setEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(matrixGetEnd - setEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(treeGetEnd - matrixGetEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(existEnd - treeGetEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(removeEnd - existEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(allPairsEnd - removeEnd).count()
+        << (checksum + found > 0 ? "" : " (empty)") << "\n";
+}
+
+//    :        
+//  -;       -
+void runOrderedQueryTest() {
+    const int size = 2000;
+    const int count = 200000;
+    const int bins = 1000;
+    std::cout << "\n=== Ordered queries: " << size << "x" << size << " matrix, " << count
+        << " non-zeros, " << bins << " bins (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Structure"
+        << std::left << std::setw(15) << "Row slices"
+        << std::left << std::setw(15) << "Histogram" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    BalanceBinaryTree<Pair<int, int>, double> tree;
+    HashTable<Pair<int, int>, double> table;
+    SparseMatrix<double> treeMatrix(&tree, size, size);
+    SparseMatrix<double> tableMatrix(&table, size, size);
+    for (int m = 0; m < count; m++) {
+        int row = rand() % size;
+        int col = rand() % size;
+        treeMatrix.set(row, col, 1.0 + m % 100);
+        tableMatrix.set(row, col, 1.0 + m % 100);
+    }
+
+    DynamicArray<double> values(count);
+    for (int m = 0; m < count; m++) {
+        values.Append((double)rand() / RAND_MAX * 1000.0);
+    }
+
+    const char* names[] = { "BalancedBinaryTree", "HashTable" };
+    SparseMatrix<double>* matrices[] = { &treeMatrix, &tableMatrix };
+    for (int s = 0; s < 2; s++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        double checksum = 0.0;
+        for (int row = 0; row < size; row++) {
+            DynamicArray<Pair<int, double>> slice;
+            matrices[s]->getRow(row, slice);
+            for (int j = 0; j < slice.GetLength(); j++) {
+                checksum += slice.GetElem(j).value;
+            }
+        }
+        auto rowsEnd = std::chrono::high_resolution_clock::now();
+
+        IDictionary<Pair<double, double>, int>* binDict = s == 0
+            ? (IDictionary<Pair<double, double>, int>*)new BalanceBinaryTree<Pair<double, double>, int>()
+            : (IDictionary<Pair<double, double>, int>*)new HashTable<Pair<double, double>, int>();
+        FixedHistogram<double> histogram(binDict, 0.0, 1000.0, bins, [](const double& v) { return v; });
+        histogram.buildHistogram(values);
+        auto histogramEnd = std::chrono::high_resolution_clock::now();
+        delete binDict;
+
+        std::cout << std::left << std::setw(25) << names[s]
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(rowsEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(histogramEnd - rowsEnd).count()
+            << (checksum > 0 ? "" : " (empty)") << "\n";
+    }
+}
+
+//  10^6    AVL-, B+-  -
+template <typename Dict>
+void measureOrderedDictionary(const char* name, Dict& dict, const DynamicArray<Pair<int, int>>& coords) {
+    const int count = coords.GetLength();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < count; m++) {
+        dict.insert(coords.GetElem(m), 1.0 + m % 100);
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+
+    double checksum = 0.0;
+    for (int m = 0; m < count; m++) {
+        checksum += *dict.find(coords.GetElem(m));
+    }
+    auto findEnd = std::chrono::high_resolution_clock::now();
+
+    int found = 0;
+    for (int m = 0; m < count; m++) {
+        found += dict.exist(Pair<int, int>(coords.GetElem(m).key, -1 - coords.GetElem(m).value)) ? 1 : 0;
+    }
+    auto missEnd = std::chrono::high_resolution_clock::now();
+
+    DynamicArray<Pair<Pair<int, int>, double>> pairs(count);
+    dict.getAllPairs(pairs);
+    auto scanEnd = std::chrono::high_resolution_clock::now();
+
+    for (int m = 0; m < count; m += 2) {
+        dict.remove(coords.GetElem(m));
+    }
+    auto removeEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(findEnd - insertEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(missEnd - findEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(scanEnd - missEnd).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(removeEnd - scanEnd).count()
+        << (checksum + found > 0 ? "" : " (empty)") << "\n";
+}
+
+void runBPlusTreeTest() {
+    const int count = 1000000;
+    std::cout << "\n=== Ordered dictionaries, " << count << " Pair<int, int> keys (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Structure"
+        << std::left << std::setw(15) << "Insert"
+        << std::left << std::setw(15) << "Find"
+        << std::left << std::setw(15) << "Miss"
+        << std::left << std::setw(15) << "All pairs"
+        << std::left << std::setw(15) << "Remove half" << "\n";
+    std::cout << std::string(25 + 15 * 5, '-') << "\n";
+
+    DynamicArray<Pair<int, int>> coords(count);
+    for (int m = 0; m < count; m++) {
+        coords.Append(Pair<int, int>(rand() % 5000, rand() % 5000));
+    }
+
+    {
+        BalanceBinaryTree<Pair<int, int>, double> tree;
+        measureOrderedDictionary("BalancedBinaryTree", tree, coords);
+    }
+    {
+        BPlusTree<Pair<int, int>, double> tree;
+        measureOrderedDictionary("BPlusTree", tree, coords);
+    }
+    {
+        HashTable<Pair<int, int>, double> table;
+        measureOrderedDictionary("HashTable", table, coords);
+    }
+}
+
+//     :       O(n)
+void runTreeBulkLoadTest() {
+    const int count = 1000000;
+    std::cout << "\n=== BalanceBinaryTree bulk load, " << count << " sorted pairs (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Operation"
+        << std::left << std::setw(15) << "One by one"
+        << std::left << std::setw(15) << "Bulk" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    DynamicArray<Pair<Pair<int, int>, double>> sorted(count);
+    DynamicArray<Pair<Pair<int, int>, double>> interleaved(count);
+    for (int m = 0; m < count; m++) {
+        sorted.Append(Pair<Pair<int, int>, double>(Pair<int, int>(m / 1000, (m % 1000) * 2), 1.0 + m % 100));
+        interleaved.Append(Pair<Pair<int, int>, double>(Pair<int, int>(m / 1000, (m % 1000) * 2 + 1), 2.0));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    BalanceBinaryTree<Pair<int, int>, double> inserted;
+    for (int m = 0; m < count; m++) {
+        inserted.insert(sorted.GetElem(m).key, sorted.GetElem(m).value);
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+    BalanceBinaryTree<Pair<int, int>, double> built(sorted);
+    auto buildEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Build"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(buildEnd - insertEnd).count()
+        << "heights " << inserted.height() << " / " << built.height() << "\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    BalanceBinaryTree<Pair<int, int>, double> reinserted;
+    DynamicArray<Pair<Pair<int, int>, double>> pairs(count);
+    built.getAllPairs(pairs);
+    for (int m = 0; m < pairs.GetLength(); m++) {
+        reinserted.insert(pairs.GetElem(m).key, pairs.GetElem(m).value);
+    }
+    auto reinsertEnd = std::chrono::high_resolution_clock::now();
+    BalanceBinaryTree<Pair<int, int>, double> copy(built);
+    auto copyEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Clone"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(reinsertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(copyEnd - reinsertEnd).count()
+        << "\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < count; m++) {
+        inserted.insert(interleaved.GetElem(m).key, interleaved.GetElem(m).value);
+    }
+    auto mergeInsertEnd = std::chrono::high_resolution_clock::now();
+    built.mergeSorted(interleaved);
+    auto mergeEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Merge"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(mergeInsertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(mergeEnd - mergeInsertEnd).count()
+        << (built.size() == inserted.size() && copy.size() == reinserted.size() ? "" : " (mismatch)") << "\n";
+}
+
+//       
+template <typename Tree>
+void measureOrderStatistics(const char* name, Tree& tree, const DynamicArray<int>& keys) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < keys.GetLength(); m++) {
+        tree.insert(keys.GetElem(m), m);
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < keys.GetLength(); m += 2) {
+        tree.remove(keys.GetElem(m));
+    }
+    auto removeEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(25) << name
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(removeEnd - insertEnd).count();
+}
+
+void runOrderStatisticsTest() {
+    const int count = 1000000;
+    std::cout << "\n=== BalanceBinaryTree order statistics, " << count << " keys (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Tree"
+        << std::left << std::setw(15) << "Insert"
+        << std::left << std::setw(15) << "Remove half"
+        << std::left << std::setw(15) << "countInRange" << "\n";
+    std::cout << std::string(25 + 15 * 3, '-') << "\n";
+
+    DynamicArray<int> keys(count);
+    for (int m = 0; m < count; m++) {
+        keys.Append(rand() % 1000000000);
+    }
+    {
+        //     ,       ,  
+        BalanceBinaryTree<int, int, NodePool> tree;
+        measureOrderStatistics("Plain", tree, keys);
+        std::cout << "-\n";
+    }
+    {
+        BalanceBinaryTree<int, int, NodePool, true> tree;
+        measureOrderStatistics("Subtree sizes", tree, keys);
+        auto start = std::chrono::high_resolution_clock::now();
+        long long counted = 0;
+        for (int m = 0; m < count; m++) {
+            counted += tree.countInRange(keys.GetElem(m), keys.GetElem(m) + 100000);
+        }
+        auto queryEnd = std::chrono::high_resolution_clock::now();
+        std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(queryEnd - start).count()
+            << (counted >= 0 ? "" : " (overflow)") << "\n";
+    }
+
+    //     ,     
+    const int total = 5000;
+    const int portion = 500;
+    DynamicArray<double> data(total);
+    for (int m = 0; m < total; m++) {
+        data.Append((double)rand() / RAND_MAX * 1000.0);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int end = portion; end <= total; end += portion) {
+        HashTable<Pair<double, double>, int> bins;
+        FloatingHistogram<double> histogram(&bins, 50, [](const double& v) { return v; });
+        DynamicArray<double> prefix(end);
+        for (int m = 0; m < end; m++) {
+            prefix.Append(data.GetElem(m));
+        }
+        histogram.buildHistogram(prefix);
+    }
+    auto rebuildEnd = std::chrono::high_resolution_clock::now();
+
+    HashTable<Pair<double, double>, int> streamBins;
+    FloatingHistogram<double> streaming(&streamBins, 50, [](const double& v) { return v; });
+    for (int end = portion; end <= total; end += portion) {
+        for (int m = end - portion; m < end; m++) {
+            streaming.addValue(data.GetElem(m));
+        }
+        streaming.updateBins();
+    }
+    auto streamEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << "FloatingHistogram, " << total << " values in portions of " << portion
+        << ": rebuild " << std::chrono::duration_cast<std::chrono::milliseconds>(rebuildEnd - start).count()
+        << " ms, streaming " << std::chrono::duration_cast<std::chrono::milliseconds>(streamEnd - rebuildEnd).count()
+        << " ms\n";
+}
+
+//        publishEvery 
+//    :  BalanceBinaryTree  snapshot()
+void runPersistentTreeTest() {
+    const int count = 200000;
+    const int snapshots = 20;
+    std::cout << "\n=== PersistentTree, " << count << " inserts (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Structure"
+        << std::left << std::setw(15) << "Insert"
+        << std::left << std::setw(15) << "Find"
+        << std::left << std::setw(15) << "Snapshots" << "\n";
+    std::cout << std::string(25 + 15 * 3, '-') << "\n";
+
+    DynamicArray<Pair<int, int>> coords(count);
+    for (int m = 0; m < count; m++) {
+        coords.Append(Pair<int, int>(rand() % 5000, rand() % 5000));
+    }
+
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        BalanceBinaryTree<Pair<int, int>, double> tree;
+        for (int m = 0; m < count; m++) {
+            tree.insert(coords.GetElem(m), 1.0 + m % 100);
+        }
+        auto insertEnd = std::chrono::high_resolution_clock::now();
+        double checksum = 0.0;
+        for (int m = 0; m < count; m++) {
+            checksum += *tree.find(coords.GetElem(m));
+        }
+        auto findEnd = std::chrono::high_resolution_clock::now();
+        for (int s = 0; s < snapshots; s++) {
+            BalanceBinaryTree<Pair<int, int>, double> copy(tree);
+            checksum += copy.size();
+        }
+        auto copyEnd = std::chrono::high_resolution_clock::now();
+        std::cout << std::left << std::setw(25) << "BalancedBinaryTree"
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(findEnd - insertEnd).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(copyEnd - findEnd).count()
+            << (checksum > 0 ? "" : " (empty)") << "\n";
+    }
+
+    const int publishPeriods[] = { 1, 100, 10000 };
+    for (int p = 0; p < 3; p++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        PersistentTree<Pair<int, int>, double> tree;
+        for (int m = 0; m < count; m++) {
+            tree.insert(coords.GetElem(m), 1.0 + m % 100);
+            if (m % publishPeriods[p] == 0) {
+                tree.publish();
+            }
+        }
+        auto insertEnd = std::chrono::high_resolution_clock::now();
+        double checksum = 0.0;
+        const PersistentTree<Pair<int, int>, double>& reader = tree;
+        for (int m = 0; m < count; m++) {
+            checksum += *reader.find(coords.GetElem(m));
+        }
+        tree.publish();
+        auto findEnd = std::chrono::high_resolution_clock::now();
+        for (int s = 0; s < snapshots; s++) {
+            checksum += tree.snapshot().size();
+        }
+        auto snapshotEnd = std::chrono::high_resolution_clock::now();
+        std::string name = "Persistent, every " + std::to_string(publishPeriods[p]);
+        std::cout << std::left << std::setw(25) << name
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(insertEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(findEnd - insertEnd).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::microseconds>(snapshotEnd - findEnd).count() / 1000.0
+            << (checksum > 0 ? "" : " (empty)") << "\n";
+    }
+}
+
+//       count / ratio :  insert/remove
+//  unionWith/subtract,   O(m log(n/m + 1)) 
+void runTreeSetOperationsTest() {
+    const int count = 1000000;
+    std::cout << "\n=== BalanceBinaryTree set operations, " << count << " keys (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Operation"
+        << std::left << std::setw(15) << "Per key"
+        << std::left << std::setw(15) << "Join-based" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    BalanceBinaryTree<int, int> base;
+    for (int m = 0; m < count; m++) {
+        base.insert((rand() % 32768) * 32768 + rand() % 32768, m);
+    }
+
+    const int ratios[] = { 1000, 10, 1 };
+    for (int r = 0; r < 3; r++) {
+        BalanceBinaryTree<int, int> other;
+        for (int m = 0; m < count / ratios[r]; m++) {
+            other.insert((rand() % 32768) * 32768 + rand() % 32768, 1);
+        }
+        auto add = [](const int& mine, const int& theirs) { return mine + theirs; };
+
+        BalanceBinaryTree<int, int> perKey(base);
+        BalanceBinaryTree<int, int> joined(base);
+        auto start = std::chrono::high_resolution_clock::now();
+        DynamicArray<Pair<int, int>> pairs(other.size());
+        other.getAllPairs(pairs);
+        for (int m = 0; m < pairs.GetLength(); m++) {
+            Pair<int*, bool> slot = perKey.tryEmplace(pairs.GetElem(m).key, pairs.GetElem(m).value);
+            if (!slot.value) {
+                *slot.key = add(*slot.key, pairs.GetElem(m).value);
+            }
+        }
+        auto perKeyEnd = std::chrono::high_resolution_clock::now();
+        joined.unionWith(other, add);
+        auto joinEnd = std::chrono::high_resolution_clock::now();
+        std::string name = "Union, 1/" + std::to_string(ratios[r]);
+        std::cout << std::left << std::setw(25) << name
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(perKeyEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(joinEnd - perKeyEnd).count()
+            << (perKey.size() == joined.size() ? "" : " (mismatch)") << "\n";
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int m = 0; m < pairs.GetLength(); m++) {
+            perKey.remove(pairs.GetElem(m).key);
+        }
+        auto removeEnd = std::chrono::high_resolution_clock::now();
+        joined.subtract(other);
+        auto subtractEnd = std::chrono::high_resolution_clock::now();
+        name = "Difference, 1/" + std::to_string(ratios[r]);
+        std::cout << std::left << std::setw(25) << name
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(removeEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(subtractEnd - removeEnd).count()
+            << (perKey.size() == joined.size() ? "" : " (mismatch)") << "\n";
+    }
+}
+
+//  DynamicArray   :   , 
+// ,   std::string      Clear
+void runDynamicArrayTest() {
+    const int count = 1000000;
+    std::cout << "\n=== DynamicArray fill, " << count << " elements (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Operation"
+        << std::left << std::setw(15) << "Time" << "\n";
+    std::cout << std::string(25 + 15, '-') << "\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    DynamicArray<double> numbers = generateRandomNumbers(0.0, 100.0, count);
+    auto generateEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "generateRandomNumbers"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(generateEnd - start).count()
+        << "\n";
+
+    HashTable<Pair<double, double>, int> bins(2 * count, 0.75);
+    BalanceBinaryTree<Pair<double, double>, int> orderedBins;
+    for (int m = 0; m < count; m++) {
+        bins.insert(Pair<double, double>(m, m + 1.0), m);
+        orderedBins.insert(Pair<double, double>(m, m + 1.0), m);
+    }
+    start = std::chrono::high_resolution_clock::now();
+    DynamicArray<Pair<Pair<double, double>, int>> hashPairs;
+    bins.getAllPairs(hashPairs);
+    auto hashEnd = std::chrono::high_resolution_clock::now();
+    DynamicArray<Pair<Pair<double, double>, int>> treePairs;
+    orderedBins.getAllPairs(treePairs);
+    auto treeEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "getAllPairs, HashTable"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(hashEnd - start).count()
+        << "\n";
+    std::cout << std::left << std::setw(25) << "getAllPairs, tree"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(treeEnd - hashEnd).count()
+        << (hashPairs.GetLength() == treePairs.GetLength() ? "" : " (mismatch)") << "\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    DynamicArray<Person> people;
+    for (int m = 0; m < count; m++) {
+        people.Append(Person(m, "Konstantinopolsky-" + std::to_string(m), "Maximilian-Alexander", 1950 + m % 70,
+            150.0 + m % 50, 50.0 + m % 60));
+    }
+    auto peopleEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Append Person"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(peopleEnd - start).count()
+        << "\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    DynamicArray<Pair<Pair<double, double>, int>> batch;
+    long long total = 0;
+    for (int round = 0; round < count / 1000; round++) {
+        batch.Clear();
+        for (int m = 0; m < 1000; m++) {
+            batch.Append(Pair<Pair<double, double>, int>(Pair<double, double>(m, m + 1.0), round));
+        }
+        total += batch.GetLength();
+    }
+    auto reuseEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Clear and refill"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(reuseEnd - start).count()
+        << (total + numbers.GetLength() == 2LL * count ? "" : " (mismatch)") << "\n";
+}
+
+//    : GetSubsequence     ,
+// GetSubsequenceView      SparseMatrix  
+void runArrayViewTest() {
+    const int count = 1000000;
+    const int window = 200000;
+    const int windows = 50;
+    std::cout << "\n=== Windows over " << count << " elements, " << windows << " x " << window << " (ms) ===\n";
+    std::cout << std::left << std::setw(25) << "Pipeline"
+        << std::left << std::setw(15) << "Copy"
+        << std::left << std::setw(15) << "View" << "\n";
+    std::cout << std::string(25 + 15 * 2, '-') << "\n";
+
+    DynamicArray<double> samples = generateRandomNumbers(0.0, 100.0, count);
+    DynamicArray<Pair<Pair<int, int>, double>> cells(count);
+    for (int m = 0; m < count; m++) {
+        cells.Append(Pair<Pair<int, int>, double>(Pair<int, int>(m / 1000, m % 1000), 1.0 + m % 100));
+    }
+
+    long long checksum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        DynamicArray<double>* slice = samples.GetSubsequence(first, first + window - 1);
+        checksum += slice->GetLength();
+        delete slice;
+    }
+    auto copyEnd = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        checksum += samples.GetSubsequenceView(first, first + window - 1).GetLength();
+    }
+    auto viewEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "Slice only"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(copyEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::microseconds>(viewEnd - copyEnd).count() / 1000.0
+        << "\n";
+
+    HashTable<Pair<double, double>, int> bins(64, 0.75);
+    FixedHistogram<double> histogram(&bins, 0.0, 100.0, 20, [](const double& x) { return x; });
+    start = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        DynamicArray<double>* slice = samples.GetSubsequence(first, first + window - 1);
+        histogram.buildHistogram(*slice);
+        delete slice;
+    }
+    copyEnd = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        histogram.buildHistogram(samples.GetSubsequenceView(first, first + window - 1));
+    }
+    viewEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "FixedHistogram"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(copyEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(viewEnd - copyEnd).count()
+        << "\n";
+
+    HashTable<Pair<int, int>, double> copied;
+    HashTable<Pair<int, int>, double> viewed;
+    SparseMatrix<double> copiedMatrix(&copied, 1000, 1000);
+    SparseMatrix<double> viewedMatrix(&viewed, 1000, 1000);
+    start = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        DynamicArray<Pair<Pair<int, int>, double>>* slice = cells.GetSubsequence(first, first + window - 1);
+        copiedMatrix.setBatch(*slice);
+        delete slice;
+    }
+    copyEnd = std::chrono::high_resolution_clock::now();
+    for (int w = 0; w < windows; w++) {
+        int first = w * (count - window) / windows;
+        viewedMatrix.setBatch(cells.GetSubsequenceView(first, first + window - 1));
+    }
+    viewEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(25) << "SparseMatrix::setBatch"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(copyEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(viewEnd - copyEnd).count()
+        << (copied.size() == viewed.size() && checksum > 0 ? "" : " (mismatch)") << "\n";
+}
+
+//  :   Sequence (ToBegin/ToEnd),
+//       STL
+void runIteratorTest() {
+    const int count = 10000000;
+    const int listCount = 1000000;
+    std::cout << "\n=== Sequence traversal, sum of elements (ms) ===\n";
+    std::cout << std::left << std::setw(30) << "Container / method"
+        << std::left << std::setw(15) << "Time" << "\n";
+    std::cout << std::string(30 + 15, '-') << "\n";
+
+    DynamicArray<double> values = generateRandomNumbers(0.0, 100.0, count);
+    double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+    auto start = std::chrono::high_resolution_clock::now();
+    Sequence<double>::Iterator* it = values.ToBegin();
+    Sequence<double>::Iterator* last = values.ToEnd();
+    for (; *it != *last; ++*it) {
+        sums[0] += **it;
+    }
+    delete it;
+    delete last;
+    auto virtualEnd = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < values.GetLength(); i++) {
+        sums[1] += values.GetElem(i);
+    }
+    auto indexEnd = std::chrono::high_resolution_clock::now();
+    for (double value : values) {
+        sums[2] += value;
+    }
+    auto rangeEnd = std::chrono::high_resolution_clock::now();
+    sums[3] = *std::max_element(values.begin(), values.end());
+    auto maxEnd = std::chrono::high_resolution_clock::now();
+    const char* names[] = { "DynamicArray / ToBegin", "DynamicArray / GetElem(i)", "DynamicArray / range-for",
+        "DynamicArray / max_element" };
+    std::chrono::high_resolution_clock::time_point marks[] = { start, virtualEnd, indexEnd, rangeEnd, maxEnd };
+    for (int m = 0; m < 4; m++) {
+        std::cout << std::left << std::setw(30) << names[m]
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(marks[m + 1] - marks[m]).count()
+            << (sums[m] > 0 ? "" : " (empty)") << "\n";
+    }
+
+    LinkedList<double> list;
+    for (int i = 0; i < listCount; i++) {
+        list.Append(values.GetElem(i));
+    }
+    double listSums[2] = { 0.0, 0.0 };
+    start = std::chrono::high_resolution_clock::now();
+    it = list.ToBegin();
+    last = list.ToEnd();
+    for (; *it != *last; ++*it) {
+        listSums[0] += **it;
+    }
+    delete it;
+    delete last;
+    virtualEnd = std::chrono::high_resolution_clock::now();
+    for (double value : list) {
+        listSums[1] += value;
+    }
+    rangeEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(30) << "LinkedList / ToBegin"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(virtualEnd - start).count()
+        << "\n";
+    std::cout << std::left << std::setw(30) << "LinkedList / range-for"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(rangeEnd - virtualEnd).count()
+        << (listSums[0] == listSums[1] ? "" : " (mismatch)") << "\n";
+}
+
+//   double   FloatingHistogram ( - ,
+//  1.5    20000 )
+void runSortTest() {
+    const int sizes[] = { 1000000, 10000000 };
+    std::cout << "\n=== Sorting doubles and FloatingHistogram build (ms), " << SortThreadCount(sizes[1], 0)
+        << " thread(s) ===\n";
+    std::cout << std::left << std::setw(25) << "Size"
+        << std::left << std::setw(15) << "std::sort"
+        << std::left << std::setw(15) << "ParallelSort"
+        << std::left << std::setw(15) << "RadixSort"
+        << std::left << std::setw(15) << "Histogram" << "\n";
+    std::cout << std::string(25 + 15 * 4, '-') << "\n";
+
+    for (int s = 0; s < 2; s++) {
+        DynamicArray<double> values = generateRandomNumbers(-100.0, 100.0, sizes[s]);
+        DynamicArray<double> sorted(values);
+        auto start = std::chrono::high_resolution_clock::now();
+        std::sort(sorted.begin(), sorted.end());
+        auto stdEnd = std::chrono::high_resolution_clock::now();
+        DynamicArray<double> merged(values);
+        auto mergeStart = std::chrono::high_resolution_clock::now();
+        ParallelSort(merged, [](double a, double b) { return a < b; });
+        auto mergeEnd = std::chrono::high_resolution_clock::now();
+        DynamicArray<double> radix(values);
+        auto radixStart = std::chrono::high_resolution_clock::now();
+        RadixSort(radix);
+        auto radixEnd = std::chrono::high_resolution_clock::now();
+        bool same = std::equal(sorted.begin(), sorted.end(), merged.begin()) &&
+            std::equal(sorted.begin(), sorted.end(), radix.begin());
+
+        HashTable<Pair<double, double>, int> bins;
+        FloatingHistogram<double> histogram(&bins, 100, [](const double& x) { return x; });
+        auto histogramStart = std::chrono::high_resolution_clock::now();
+        histogram.buildHistogram(values);
+        auto histogramEnd = std::chrono::high_resolution_clock::now();
+
+        std::cout << std::left << std::setw(25) << sizes[s]
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(stdEnd - start).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(mergeEnd - mergeStart).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(radixEnd - radixStart).count()
+            << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(histogramEnd - histogramStart).count()
+            << (same && bins.size() == sizes[s] / 100 ? "" : " (mismatch)") << "\n";
+    }
+}
+
+//    :     3 
+//     4 , DynamicArray  SmallDynamicArray
+void runSmallArrayTest() {
+    const int rows = 100000;
+    const int rounds = 10;
+    const int dumps = 1000000;
+    std::cout << "\n=== Short-lived arrays, DynamicArray vs SmallDynamicArray (ms) ===\n";
+    std::cout << std::left << std::setw(30) << "Workload"
+        << std::left << std::setw(15) << "DynamicArray"
+        << std::left << std::setw(15) << "SmallDynamic" << "\n";
+    std::cout << std::string(30 + 15 * 2, '-') << "\n";
+
+    BalanceBinaryTree<Pair<int, int>, double> cells;
+    SparseMatrix<double> matrix(&cells, rows, 10);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < 3; c++) {
+            matrix.set(r, (r + c * 3) % 10, r + c + 1.0);
+        }
+    }
+    double sums[2] = { 0.0, 0.0 };
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int r = 0; r < rows; r++) {
+            DynamicArray<Pair<int, double>> row;
+            matrix.getRow(r, row);
+            sums[0] += row.GetElem(0).value;
+        }
+    }
+    auto plainEnd = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int r = 0; r < rows; r++) {
+            SmallDynamicArray<Pair<int, double>, 8> row;
+            matrix.getRow(r, row);
+            sums[1] += row.GetElem(0).value;
+        }
+    }
+    auto smallEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(30) << "getRow, 3 per row"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(plainEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(smallEnd - plainEnd).count()
+        << (sums[0] == sums[1] ? "" : " (mismatch)") << "\n";
+
+    HashTable<Pair<double, double>, int> bins;
+    for (int b = 0; b < 4; b++) {
+        bins.insert(Pair<double, double>(b, b + 1.0), b);
+    }
+    long long counts[2] = { 0, 0 };
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < dumps; i++) {
+        DynamicArray<Pair<Pair<double, double>, int>> pairs;
+        bins.getAllPairs(pairs);
+        counts[0] += pairs.GetLength();
+    }
+    plainEnd = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < dumps; i++) {
+        SmallDynamicArray<Pair<Pair<double, double>, int>, 16> pairs;
+        bins.getAllPairs(pairs);
+        counts[1] += pairs.GetLength();
+    }
+    smallEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::left << std::setw(30) << "getAllPairs, 4 bins"
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(plainEnd - start).count()
+        << std::left << std::setw(15) << std::chrono::duration_cast<std::chrono::milliseconds>(smallEnd - plainEnd).count()
+        << (counts[0] == counts[1] ? "" : " (mismatch)") << "\n";
+}
+
 void runLoadTests() {
     std::cout << "=== Load Tests ===\n";
 
@@ -80,7 +1443,10 @@ void runLoadTests() {
 
     Structure structures[] = {
         {"BalancedBinaryTree", Structure::BALANCED_BINARY_TREE},
-        {"HashTable", Structure::HASH_TABLE}
+        {"BPlusTree", Structure::B_PLUS_TREE},
+        {"HashTable", Structure::HASH_TABLE},
+        {"GroupHashTable", Structure::GROUP_HASH_TABLE},
+        {"RobinHoodHashTable", Structure::ROBIN_HOOD_HASH_TABLE}
     };
     const int numStructures = sizeof(structures) / sizeof(structures[0]);
 
@@ -116,12 +1482,30 @@ void runLoadTests() {
                             [](const double& x) -> double { return x; });
                         fixHistTree.buildHistogram(bigData);
                     }
+                    else if (currentStructure.type == Structure::B_PLUS_TREE) {
+                        BPlusTree<Pair<double, double>, int> bplusDict;
+                        FixedHistogram<double, double> fixHistBPlus(&bplusDict, 0.0, 100.0, 10,
+                            [](const double& x) -> double { return x; });
+                        fixHistBPlus.buildHistogram(bigData);
+                    }
                     else if (currentStructure.type == Structure::HASH_TABLE) {
                         HashTable<Pair<double, double>, int> hashDict(10000, 0.5);
                         FixedHistogram<double, double> fixHistHash(&hashDict, 0.0, 100.0, 10,
                             [](const double& x) -> double { return x; });
                         fixHistHash.buildHistogram(bigData);
                     }
+                    else if (currentStructure.type == Structure::GROUP_HASH_TABLE) {
+                        GroupHashTable<Pair<double, double>, int> groupDict;
+                        FixedHistogram<double, double> fixHistGroup(&groupDict, 0.0, 100.0, 10,
+                            [](const double& x) -> double { return x; });
+                        fixHistGroup.buildHistogram(bigData);
+                    }
+                    else if (currentStructure.type == Structure::ROBIN_HOOD_HASH_TABLE) {
+                        RobinHoodHashTable<Pair<double, double>, int> robinDict;
+                        FixedHistogram<double, double> fixHistRobin(&robinDict, 0.0, 100.0, 10,
+                            [](const double& x) -> double { return x; });
+                        fixHistRobin.buildHistogram(bigData);
+                    }
                 }
                 else if (currentOperation.type == Operation::FLOATING_HISTOGRAM) {
                     if (currentStructure.type == Structure::BALANCED_BINARY_TREE) {
@@ -130,12 +1514,30 @@ void runLoadTests() {
                             [](const double& x) -> double { return x; });
                         floatHistTree.buildHistogram(bigData);
                     }
+                    else if (currentStructure.type == Structure::B_PLUS_TREE) {
+                        BPlusTree<Pair<double, double>, int> bplusDict;
+                        FloatingHistogram<double, double> floatHistBPlus(&bplusDict, 100.0,
+                            [](const double& x) -> double { return x; });
+                        floatHistBPlus.buildHistogram(bigData);
+                    }
                     else if (currentStructure.type == Structure::HASH_TABLE) {
                         HashTable<Pair<double, double>, int> hashDict(10000, 0.5);
                         FloatingHistogram<double, double> floatHistHash(&hashDict, 100.0,
                             [](const double& x) -> double { return x; });
                         floatHistHash.buildHistogram(bigData);
                     }
+                    else if (currentStructure.type == Structure::GROUP_HASH_TABLE) {
+                        GroupHashTable<Pair<double, double>, int> groupDict;
+                        FloatingHistogram<double, double> floatHistGroup(&groupDict, 100.0,
+                            [](const double& x) -> double { return x; });
+                        floatHistGroup.buildHistogram(bigData);
+                    }
+                    else if (currentStructure.type == Structure::ROBIN_HOOD_HASH_TABLE) {
+                        RobinHoodHashTable<Pair<double, double>, int> robinDict;
+                        FloatingHistogram<double, double> floatHistRobin(&robinDict, 100.0,
+                            [](const double& x) -> double { return x; });
+                        floatHistRobin.buildHistogram(bigData);
+                    }
                 }
                 else if (currentOperation.type == Operation::SPARSE_MATRIX) {
                     if (currentStructure.type == Structure::BALANCED_BINARY_TREE) {
@@ -148,6 +1550,16 @@ void runLoadTests() {
                             sparseMatTree.set(r, c, val);
                         }
                     }
+                    else if (currentStructure.type == Structure::B_PLUS_TREE) {
+                        BPlusTree<Pair<int, int>, double> matBPlus;
+                        SparseMatrix<double> sparseMatBPlus(&matBPlus, 1000, 1000);
+                        for (int m = 0; m < currentSize; m++) {
+                            int r = rand() % 1000;
+                            int c = rand() % 1000;
+                            double val = static_cast<double>(rand() % 1000) / 10.0;
+                            sparseMatBPlus.set(r, c, val);
+                        }
+                    }
                     else if (currentStructure.type == Structure::HASH_TABLE) {
                         HashTable<Pair<int, int>, double> matHash(200000, 0.5);
                         SparseMatrix<double> sparseMatHash(&matHash, 1000, 1000);
@@ -158,6 +1570,26 @@ void runLoadTests() {
                             sparseMatHash.set(r, c, val);
                         }
                     }
+                    else if (currentStructure.type == Structure::GROUP_HASH_TABLE) {
+                        GroupHashTable<Pair<int, int>, double> matGroup;
+                        SparseMatrix<double> sparseMatGroup(&matGroup, 1000, 1000);
+                        for (int m = 0; m < currentSize; m++) {
+                            int r = rand() % 1000;
+                            int c = rand() % 1000;
+                            double val = static_cast<double>(rand() % 1000) / 10.0;
+                            sparseMatGroup.set(r, c, val);
+                        }
+                    }
+                    else if (currentStructure.type == Structure::ROBIN_HOOD_HASH_TABLE) {
+                        RobinHoodHashTable<Pair<int, int>, double> matRobin;
+                        SparseMatrix<double> sparseMatRobin(&matRobin, 1000, 1000);
+                        for (int m = 0; m < currentSize; m++) {
+                            int r = rand() % 1000;
+                            int c = rand() % 1000;
+                            double val = static_cast<double>(rand() % 1000) / 10.0;
+                            sparseMatRobin.set(r, c, val);
+                        }
+                    }
                 }
 
                 auto end = std::chrono::high_resolution_clock::now();
@@ -176,4 +1608,28 @@ void runLoadTests() {
     }
 
     displayResults(allResults, testSizes, numTestSizes, structures, numStructures, operations, numOperations);
+
+    runRehashLatencyTest();
+    runSparseMatrixChurnTest();
+    runCapacityPolicyTest();
+    runHashDiagnostics();
+    runConcurrentIngestionTest();
+    runSparseMatrixBulkBuildTest();
+    runHashTableStatsReport();
+    runSnapshotTest();
+    runSparseMatrixMemoryTest();
+    runCachedHashTest();
+    runTreeAllocatorTest();
+    runTreeLookupTest();
+    runOrderedQueryTest();
+    runBPlusTreeTest();
+    runTreeBulkLoadTest();
+    runOrderStatisticsTest();
+    runPersistentTreeTest();
+    runTreeSetOperationsTest();
+    runDynamicArrayTest();
+    runArrayViewTest();
+    runIteratorTest();
+    runSortTest();
+    runSmallArrayTest();
 }
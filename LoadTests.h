@@ -5,8 +5,17 @@
 #include <cstdlib>
 #include <iostream>
 #include <ctime> 
+#include <algorithm>
+#include <thread>
+#include <mutex>
 #include "BalanceBinaryTree.h"
+#include "BPlusTree.h"
+#include "PersistentTree.h"
 #include "HashTable.h"
+#include "GroupHashTable.h"
+#include "RobinHoodHashTable.h"
+#include "ShardedHashTable.h"
+#include "HashTableSnapshot.h"
 #include "Histogram.h"
 #include "SparseMatrix.h"
 #include "Pair.h"
@@ -15,5 +24,9 @@
 
 #include <string>
 #include "DynamicArray.h"
+#include "SmallDynamicArray.h"
+#include "LinkedList.h"
+#include "Sort.h"
+#include "Person.h"
 
 void runLoadTests();
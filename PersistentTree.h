@@ -0,0 +1,504 @@
+// PersistentTree.h
+#pragma once
+
+#include "IOrderedDictionary.h"
+#include "DynamicArray.h"
+#include "Pair.h"
+#include <memory>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+
+// std::atomic<std::shared_ptr> (C++20);   -   std::atomic_load /
+// std::atomic_store,   C++20  
+#if defined(__cpp_lib_atomic_shared_ptr)
+#define PERSISTENT_TREE_ATOMIC_SHARED_PTR 1
+#else
+#define PERSISTENT_TREE_ATOMIC_SHARED_PTR 0
+#endif
+
+//   AVL-.     ,
+//         shared_ptr
+template <typename Key, typename Value>
+struct PersistentNode {
+    Pair<Key, Value> pair;
+    std::shared_ptr<PersistentNode> left;
+    std::shared_ptr<PersistentNode> right;
+    int height;
+    unsigned version;  //  ,    
+
+    PersistentNode(const Key& k, const Value& v, unsigned version)
+        : pair(k, v), height(1), version(version) {}
+};
+
+//  AVL-:         .
+//        : ,   
+// ,   ,       .
+// publish()  O(1)    , snapshot()   
+//       .  , 
+//       
+template <typename Key, typename Value>
+class PersistentTree : public IOrderedDictionary<Key, Value> {
+private:
+    typedef PersistentNode<Key, Value> Node;
+    typedef std::shared_ptr<Node> NodePtr;
+
+    //  
+    struct Version {
+        NodePtr root;
+        int size;
+    };
+
+    //  AVL-  n < 2^31  64
+    static const int MAX_HEIGHT = 64;
+
+    NodePtr root;
+    int nodeCount;
+    unsigned version;
+#if PERSISTENT_TREE_ATOMIC_SHARED_PTR
+    std::atomic<std::shared_ptr<const Version>> published;
+#else
+    //      std::atomic_load / std::atomic_store
+    std::shared_ptr<const Version> published;
+#endif
+
+    // ,     
+
+    static const Node* findNode(const Node* node, const Key& key) {
+        while (node) {
+            if (key < node->pair.key) node = node->left.get();
+            else if (node->pair.key < key) node = node->right.get();
+            else return node;
+        }
+        return nullptr;
+    }
+
+    static const Pair<Key, Value>* lowerBoundIn(const Node* node, const Key& key) {
+        const Node* result = nullptr;
+        while (node) {
+            if (node->pair.key < key) {
+                node = node->right.get();
+            }
+            else {
+                result = node;
+                node = node->left.get();
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    static const Pair<Key, Value>* upperBoundIn(const Node* node, const Key& key) {
+        const Node* result = nullptr;
+        while (node) {
+            if (key < node->pair.key) {
+                result = node;
+                node = node->left.get();
+            }
+            else {
+                node = node->right.get();
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    static const Pair<Key, Value>* floorIn(const Node* node, const Key& key) {
+        const Node* result = nullptr;
+        while (node) {
+            if (key < node->pair.key) {
+                node = node->left.get();
+            }
+            else {
+                result = node;
+                node = node->right.get();
+            }
+        }
+        return result ? &result->pair : nullptr;
+    }
+
+    //  [lo, hi)   ,   BalanceBinaryTree
+    template <typename Visitor>
+    static void forEachIn(const Node* node, const Key& lo, const Key& hi, Visitor& visit) {
+        const Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        while (node) {
+            if (node->pair.key < lo) {
+                node = node->right.get();
+            }
+            else {
+                stack[depth++] = node;
+                node = node->left.get();
+            }
+        }
+
+        while (depth > 0) {
+            node = stack[--depth];
+            if (!(node->pair.key < hi)) {
+                return;
+            }
+            visit(node->pair);
+            for (node = node->right.get(); node; node = node->left.get()) {
+                stack[depth++] = node;
+            }
+        }
+    }
+
+    static void fillArray(const Node* node, DynamicArray<Pair<Key, Value>>& arr) {
+        const Node* stack[MAX_HEIGHT];
+        int depth = 0;
+        while (node || depth > 0) {
+            while (node) {
+                stack[depth++] = node;
+                node = node->left.get();
+            }
+            node = stack[--depth];
+            arr.EmplaceBack(node->pair);
+            node = node->right.get();
+        }
+    }
+
+    //  
+
+    static int getHeight(const NodePtr& node) {
+        return node ? node->height : 0;
+    }
+
+    static int getBalanceFactor(const Node* node) {
+        return getHeight(node->left) - getHeight(node->right);
+    }
+
+    static void updateHeight(Node* node) {
+        int hl = getHeight(node->left);
+        int hr = getHeight(node->right);
+        node->height = (hl > hr ? hl : hr) + 1;
+    }
+
+    //      ;    slot  
+    void own(NodePtr& slot) {
+        if (slot->version != version) {
+            NodePtr copy = std::make_shared<Node>(*slot);
+            copy->version = version;
+            slot = std::move(copy);
+        }
+    }
+
+    //    slot; slot      
+    static void rotateRight(NodePtr& slot) {
+        NodePtr x = std::move(slot->left);
+        slot->left = std::move(x->right);
+        updateHeight(slot.get());
+        x->right = std::move(slot);
+        updateHeight(x.get());
+        slot = std::move(x);
+    }
+
+    static void rotateLeft(NodePtr& slot) {
+        NodePtr y = std::move(slot->right);
+        slot->right = std::move(y->left);
+        updateHeight(slot.get());
+        y->left = std::move(slot);
+        updateHeight(y.get());
+        slot = std::move(y);
+    }
+
+    void rebalance(NodePtr& slot) {
+        Node* node = slot.get();
+        updateHeight(node);
+        int balance = getBalanceFactor(node);
+        if (balance > 1) {
+            own(node->left);
+            if (getBalanceFactor(node->left.get()) < 0) {
+                own(node->left->right);
+                rotateLeft(node->left);
+            }
+            rotateRight(slot);
+        }
+        else if (balance < -1) {
+            own(node->right);
+            if (getBalanceFactor(node->right.get()) > 0) {
+                own(node->right->left);
+                rotateRight(node->right);
+            }
+            rotateLeft(slot);
+        }
+    }
+
+    // ,   ( )   path[i]
+    NodePtr& slotOf(Node** path, int i) {
+        if (i == 0) {
+            return root;
+        }
+        Node* parent = path[i - 1];
+        return parent->left.get() == path[i] ? parent->left : parent->right;
+    }
+
+    //   path[depth - 1]       ;  ,
+    //    ,   
+    void rebalancePath(Node** path, int depth) {
+        for (int i = depth - 1; i >= 0; i--) {
+            NodePtr& slot = slotOf(path, i);
+            int oldHeight = slot->height;
+            rebalance(slot);
+            if (slot->height == oldHeight) {
+                break;
+            }
+        }
+    }
+
+    //   key,       .   ;
+    // found -     key
+    int ownPath(const Key& key, Node** path, bool& found) {
+        int depth = 0;
+        NodePtr* slot = &root;
+        found = false;
+        while (*slot) {
+            own(*slot);
+            Node* node = slot->get();
+            path[depth++] = node;
+            if (key < node->pair.key) {
+                slot = &node->left;
+            }
+            else if (node->pair.key < key) {
+                slot = &node->right;
+            }
+            else {
+                found = true;
+                break;
+            }
+        }
+        return depth;
+    }
+
+    Pair<Value*, bool> insertNode(const Key& key, const Value& value, bool overwrite) {
+        Node* path[MAX_HEIGHT];
+        bool found;
+        int depth = ownPath(key, path, found);
+        if (found) {
+            Node* node = path[depth - 1];
+            if (overwrite) {
+                node->pair.value = value;
+            }
+            return Pair<Value*, bool>(&node->pair.value, false);
+        }
+
+        NodePtr created = std::make_shared<Node>(key, value, version);
+        Value* result = &created->pair.value;
+        if (depth == 0) {
+            root = std::move(created);
+        }
+        else if (key < path[depth - 1]->pair.key) {
+            path[depth - 1]->left = std::move(created);
+        }
+        else {
+            path[depth - 1]->right = std::move(created);
+        }
+        nodeCount++;
+        rebalancePath(path, depth);
+        return Pair<Value*, bool>(result, true);
+    }
+
+    //       ,   
+    bool removeNode(const Key& key) {
+        //      
+        if (!findNode(root.get(), key)) {
+            return false;
+        }
+
+        Node* path[MAX_HEIGHT];
+        bool found;
+        int depth = ownPath(key, path, found);
+        Node* node = path[depth - 1];
+        if (node->left && node->right) {
+            NodePtr* slot = &node->right;
+            while ((*slot)->left) {
+                own(*slot);
+                path[depth++] = slot->get();
+                slot = &(*slot)->left;
+            }
+            node->pair = (*slot)->pair;
+            NodePtr right = (*slot)->right;
+            *slot = std::move(right);
+        }
+        else {
+            NodePtr child = node->left ? node->left : node->right;
+            slotOf(path, depth - 1) = std::move(child);
+            depth--;
+        }
+        nodeCount--;
+        rebalancePath(path, depth);
+        return true;
+    }
+
+public:
+    //   .   O(1)      ;
+    //    
+    class Snapshot : public IOrderedDictionary<Key, Value> {
+    private:
+        std::shared_ptr<const Version> data;
+
+    public:
+        explicit Snapshot(std::shared_ptr<const Version> data) : data(std::move(data)) {}
+
+        void insert(const Key&, const Value&) override {
+            throw std::runtime_error("PersistentTree snapshot is read-only.");
+        }
+
+        Pair<Value*, bool> tryEmplace(const Key&, const Value&) override {
+            throw std::runtime_error("PersistentTree snapshot is read-only.");
+        }
+
+        bool remove(const Key&) override {
+            throw std::runtime_error("PersistentTree snapshot is read-only.");
+        }
+
+        //      ,    
+        Value* find(const Key&) override {
+            throw std::runtime_error("PersistentTree snapshot is read-only.");
+        }
+
+        const Value* find(const Key& key) const override {
+            const Node* node = findNode(data->root.get(), key);
+            return node ? &node->pair.value : nullptr;
+        }
+
+        bool exist(const Key& key) const override {
+            return findNode(data->root.get(), key) != nullptr;
+        }
+
+        Value get(const Key& key) const override {
+            const Node* node = findNode(data->root.get(), key);
+            if (!node) throw std::runtime_error("Key not found");
+            return node->pair.value;
+        }
+
+        void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+            arr.Reserve(arr.GetLength() + data->size);
+            fillArray(data->root.get(), arr);
+        }
+
+        const Pair<Key, Value>* lowerBound(const Key& key) const override {
+            return lowerBoundIn(data->root.get(), key);
+        }
+
+        const Pair<Key, Value>* upperBound(const Key& key) const override {
+            return upperBoundIn(data->root.get(), key);
+        }
+
+        const Pair<Key, Value>* floor(const Key& key) const override {
+            return floorIn(data->root.get(), key);
+        }
+
+        template <typename Visitor>
+        void forEachInRange(const Key& lo, const Key& hi, Visitor visit) const {
+            forEachIn(data->root.get(), lo, hi, visit);
+        }
+
+        void visitRange(const Key& lo, const Key& hi, typename IOrderedDictionary<Key, Value>::RangeVisitor visitor,
+            void* context) const override {
+            forEachInRange(lo, hi, [visitor, context](const Pair<Key, Value>& pair) { visitor(pair, context); });
+        }
+
+        int size() const {
+            return data->size;
+        }
+    };
+
+    PersistentTree() : nodeCount(0), version(1), published(std::make_shared<const Version>(Version{ NodePtr(), 0 })) {}
+
+    //       ;    
+    PersistentTree(const PersistentTree&) = delete;
+    PersistentTree& operator=(const PersistentTree&) = delete;
+
+    void insert(const Key& key, const Value& value) override {
+        insertNode(key, value, true);
+    }
+
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        return insertNode(key, value, false);
+    }
+
+    //       ,      
+    Value* find(const Key& key) override {
+        if (!findNode(root.get(), key)) {
+            return nullptr;
+        }
+        Node* path[MAX_HEIGHT];
+        bool found;
+        int depth = ownPath(key, path, found);
+        return &path[depth - 1]->pair.value;
+    }
+
+    const Value* find(const Key& key) const override {
+        const Node* node = findNode(root.get(), key);
+        return node ? &node->pair.value : nullptr;
+    }
+
+    bool exist(const Key& key) const override {
+        return findNode(root.get(), key) != nullptr;
+    }
+
+    Value get(const Key& key) const override {
+        const Node* node = findNode(root.get(), key);
+        if (!node) throw std::runtime_error("Key not found");
+        return node->pair.value;
+    }
+
+    bool remove(const Key& key) override {
+        return removeNode(key);
+    }
+
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + nodeCount);
+        fillArray(root.get(), arr);
+    }
+
+    const Pair<Key, Value>* lowerBound(const Key& key) const override {
+        return lowerBoundIn(root.get(), key);
+    }
+
+    const Pair<Key, Value>* upperBound(const Key& key) const override {
+        return upperBoundIn(root.get(), key);
+    }
+
+    const Pair<Key, Value>* floor(const Key& key) const override {
+        return floorIn(root.get(), key);
+    }
+
+    template <typename Visitor>
+    void forEachInRange(const Key& lo, const Key& hi, Visitor visit) const {
+        forEachIn(root.get(), lo, hi, visit);
+    }
+
+    void visitRange(const Key& lo, const Key& hi, typename IOrderedDictionary<Key, Value>::RangeVisitor visitor,
+        void* context) const override {
+        forEachInRange(lo, hi, [visitor, context](const Pair<Key, Value>& pair) { visitor(pair, context); });
+    }
+
+    //    .     
+    // ,    .   
+    void publish() {
+        std::shared_ptr<const Version> next = std::make_shared<const Version>(Version{ root, nodeCount });
+#if PERSISTENT_TREE_ATOMIC_SHARED_PTR
+        published.store(std::move(next));
+#else
+        std::atomic_store(&published, next);
+#endif
+        version++;
+    }
+
+    //   ;     
+    Snapshot snapshot() const {
+#if PERSISTENT_TREE_ATOMIC_SHARED_PTR
+        return Snapshot(published.load());
+#else
+        return Snapshot(std::atomic_load(&published));
+#endif
+    }
+
+    int size() const {
+        return nodeCount;
+    }
+
+    int height() const {
+        return getHeight(root);
+    }
+};
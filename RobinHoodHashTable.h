@@ -0,0 +1,259 @@
+// RobinHoodHashTable.h
+#pragma once
+
+#include "IDictionary.h"
+#include "Pair.h"
+#include "DefaultHash.h"
+#include <stdexcept>
+#include <cstdint>
+
+// -      Robin Hood:
+//   ,     ,   .
+//     ,    () .
+template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>>
+class RobinHoodHashTable : public IDictionary<Key, Value> {
+private:
+    Pair<Key, Value>* slots; //  -
+    int* distances;          //    ; -1   
+    int capacity;            //  ( )
+    int shift;               // 64 - log2(capacity)   
+    int count;               //  
+    double loadFactor;       //     
+    HashFunc hashFunc;       // -
+
+    //  :     2^64 / phi
+    int homeIndex(const Key& key) const {
+        uint64_t h = (uint64_t)hashFunc(key) * 0x9E3779B97F4A7C15ull;
+        return (int)(h >> shift);
+    }
+
+    void allocate(int newCapacity) {
+        capacity = newCapacity;
+        shift = 64;
+        for (int c = capacity; c > 1; c >>= 1) {
+            shift--;
+        }
+        slots = new Pair<Key, Value>[capacity];
+        distances = new int[capacity];
+        for (int i = 0; i < capacity; i++) {
+            distances[i] = -1;
+        }
+        count = 0;
+    }
+
+    static int roundUpCapacity(int n) {
+        int result = 8;
+        while (result < n) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    //    ; -1,   
+    int findIndex(const Key& key) const {
+        int mask = capacity - 1;
+        int index = homeIndex(key);
+        for (int distance = 0; ; distance++) {
+            //       :     
+            if (distances[index] < distance) {
+                return -1;
+            }
+            if (distances[index] == distance && slots[index].key == key) {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    //  ,     ;   
+    int placeEntry(Pair<Key, Value> entry) {
+        int mask = capacity - 1;
+        int index = homeIndex(entry.key);
+        int distance = 0;
+        int placedIndex = -1;
+
+        while (true) {
+            if (distances[index] < 0) {
+                slots[index] = entry;
+                distances[index] = distance;
+                count++;
+                return placedIndex >= 0 ? placedIndex : index;
+            }
+            if (distances[index] < distance) {
+                //          
+                Pair<Key, Value> displaced = slots[index];
+                int displacedDistance = distances[index];
+                slots[index] = entry;
+                distances[index] = distance;
+                if (placedIndex < 0) {
+                    placedIndex = index;
+                }
+                entry = displaced;
+                distance = displacedDistance;
+            }
+            index = (index + 1) & mask;
+            distance++;
+        }
+    }
+
+    void grow() {
+        int oldCapacity = capacity;
+        Pair<Key, Value>* oldSlots = slots;
+        int* oldDistances = distances;
+
+        allocate(oldCapacity * 2);
+        for (int i = 0; i < oldCapacity; i++) {
+            if (oldDistances[i] >= 0) {
+                placeEntry(oldSlots[i]);
+            }
+        }
+
+        delete[] oldSlots;
+        delete[] oldDistances;
+    }
+
+    void copyFrom(const RobinHoodHashTable& other) {
+        capacity = other.capacity;
+        shift = other.shift;
+        count = other.count;
+        loadFactor = other.loadFactor;
+        hashFunc = other.hashFunc;
+        slots = new Pair<Key, Value>[capacity];
+        distances = new int[capacity];
+        for (int i = 0; i < capacity; i++) {
+            slots[i] = other.slots[i];
+            distances[i] = other.distances[i];
+        }
+    }
+
+public:
+    // 
+    RobinHoodHashTable(int initialCapacity = 16, double loadFactor = 0.8)
+        : loadFactor(loadFactor), hashFunc(HashFunc()) {
+        if (this->loadFactor <= 0.0 || this->loadFactor >= 1.0) {
+            this->loadFactor = 0.8;
+        }
+        allocate(roundUpCapacity(initialCapacity));
+    }
+
+    //  
+    RobinHoodHashTable(const RobinHoodHashTable& other) {
+        copyFrom(other);
+    }
+
+    //   
+    RobinHoodHashTable& operator=(const RobinHoodHashTable& other) {
+        if (this == &other) {
+            return *this;
+        }
+        delete[] slots;
+        delete[] distances;
+        copyFrom(other);
+        return *this;
+    }
+
+    // 
+    ~RobinHoodHashTable() {
+        delete[] slots;
+        delete[] distances;
+    }
+
+    //   -
+    void insert(const Key& key, const Value& value) override {
+        Pair<Value*, bool> result = tryEmplace(key, value);
+        if (!result.value) {
+            *result.key = value;
+        }
+    }
+
+    // ,     
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        int index = findIndex(key);
+        if (index >= 0) {
+            return Pair<Value*, bool>(&slots[index].value, false);
+        }
+
+        if ((double)(count + 1) / capacity > loadFactor) {
+            grow();
+        }
+        index = placeEntry(Pair<Key, Value>(key, value));
+        return Pair<Value*, bool>(&slots[index].value, true);
+    }
+
+    //    
+    Value* find(const Key& key) override {
+        int index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    const Value* find(const Key& key) const override {
+        int index = findIndex(key);
+        return index >= 0 ? &slots[index].value : nullptr;
+    }
+
+    //   
+    bool exist(const Key& key) const override {
+        return findIndex(key) >= 0;
+    }
+
+    //    
+    Value get(const Key& key) const override {
+        int index = findIndex(key);
+        if (index < 0) {
+            throw std::runtime_error("Key not found in RobinHoodHashTable.");
+        }
+        return slots[index].value;
+    }
+
+    //         
+    bool remove(const Key& key) override {
+        int index = findIndex(key);
+        if (index < 0) {
+            return false;
+        }
+
+        int mask = capacity - 1;
+        int next = (index + 1) & mask;
+        while (distances[next] > 0) {
+            slots[index] = slots[next];
+            distances[index] = distances[next] - 1;
+            index = next;
+            next = (next + 1) & mask;
+        }
+        slots[index] = Pair<Key, Value>();
+        distances[index] = -1;
+        count--;
+        return true;
+    }
+
+    //    -
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        arr.Reserve(arr.GetLength() + count);
+        for (int i = 0; i < capacity; i++) {
+            if (distances[i] >= 0) {
+                arr.EmplaceBack(slots[i]);
+            }
+        }
+    }
+
+    //  
+    int size() const {
+        return count;
+    }
+
+    //  
+    int getCapacity() const {
+        return capacity;
+    }
+
+    //      
+    int maxProbeLength() const {
+        int result = 0;
+        for (int i = 0; i < capacity; i++) {
+            if (distances[i] > result) {
+                result = distances[i];
+            }
+        }
+        return result;
+    }
+};
@@ -0,0 +1,141 @@
+// ShardedHashTable.h
+#pragma once
+
+#include "IDictionary.h"
+#include "HashTable.h"
+#include "Pair.h"
+#include "DefaultHash.h"
+#include <mutex>
+#include <cstdint>
+
+//    N  - (),    .
+//      ,       ,
+//    ()    .
+template <typename Key, typename Value, typename HashFunc = DefaultHash<Key>>
+class ShardedHashTable : public IDictionary<Key, Value> {
+private:
+    //   -,        
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        HashTable<Key, Value, HashFunc> table;
+    };
+
+    Shard* shards;
+    int shardCount; //  
+    int shardShift; // 64 - log2(shardCount)
+    HashFunc hashFunc;
+
+    Shard& shardFor(const Key& key) const {
+        if (shardCount == 1) {
+            return shards[0];
+        }
+        uint64_t hash = (uint64_t)hashFunc(key);
+        return shards[hash >> shardShift];
+    }
+
+public:
+    // :       
+    ShardedHashTable(int shardCount = 16, int initialCapacityPerShard = 11, double loadFactor = 0.75)
+        : IDictionary<Key, Value>(true), shardCount(1), shardShift(64), hashFunc(HashFunc()) {
+        while (this->shardCount < shardCount) {
+            this->shardCount *= 2;
+            shardShift--;
+        }
+        shards = new Shard[this->shardCount];
+        for (int i = 0; i < this->shardCount; i++) {
+            shards[i].table = HashTable<Key, Value, HashFunc>(initialCapacityPerShard, loadFactor);
+        }
+    }
+
+    ShardedHashTable(const ShardedHashTable&) = delete;
+    ShardedHashTable& operator=(const ShardedHashTable&) = delete;
+
+    ~ShardedHashTable() {
+        delete[] shards;
+    }
+
+    void insert(const Key& key, const Value& value) override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.table.insert(key, value);
+    }
+
+    bool exist(const Key& key) const override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.exist(key);
+    }
+
+    Value get(const Key& key) const override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.get(key);
+    }
+
+    bool remove(const Key& key) override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.remove(key);
+    }
+
+    // find/tryEmplace    ,     :
+    //  ,         (
+    // ,     ).  
+    //      tryGet/get   update/upsert
+    Value* find(const Key& key) override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.find(key);
+    }
+
+    const Value* find(const Key& key) const override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.find(key);
+    }
+
+    Pair<Value*, bool> tryEmplace(const Key& key, const Value& value) override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.table.tryEmplace(key, value);
+    }
+
+    bool tryGet(const Key& key, Value& out) const override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const Value* value = shard.table.find(key);
+        if (!value) {
+            return false;
+        }
+        out = *value;
+        return true;
+    }
+
+    //    : func    
+    void update(const Key& key, const std::function<void(Value&)>& func) override {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        func(*shard.table.tryEmplace(key, Value()).key);
+    }
+
+    void getAllPairs(DynamicArray<Pair<Key, Value>>& arr) const override {
+        for (int i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].table.getAllPairs(arr);
+        }
+    }
+
+    //     
+    int size() const {
+        int total = 0;
+        for (int i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].table.size();
+        }
+        return total;
+    }
+
+    int getShardCount() const {
+        return shardCount;
+    }
+};
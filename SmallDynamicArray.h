@@ -0,0 +1,58 @@
+// SmallDynamicArray.h
+#pragma once
+#include "DynamicArray.h"
+#include <utility>
+
+// DynamicArray     N :     N,
+//   .     (  ,
+//     ..).  DynamicArray,  
+//  getAllPairs, getRow   ,  DynamicArray<T>&
+template <class T, int N>
+class SmallDynamicArray : public DynamicArray<T>
+{
+    static_assert(N > 0, "SmallDynamicArray needs a non-empty inline buffer");
+
+private:
+    alignas(T) unsigned char storage[sizeof(T) * N];
+
+public:
+    SmallDynamicArray() : DynamicArray<T>(typename DynamicArray<T>::InlineBuffer(), reinterpret_cast<T*>(storage), N) {}
+
+    SmallDynamicArray(const SmallDynamicArray<T, N>& other) : SmallDynamicArray() {
+        DynamicArray<T>::operator=(other);
+    }
+
+    SmallDynamicArray(const DynamicArray<T>& other) : SmallDynamicArray() {
+        DynamicArray<T>::operator=(other);
+    }
+
+    explicit SmallDynamicArray(ArrayView<const T> items) : SmallDynamicArray() {
+        this->Reserve(items.GetLength());
+        for (const T& item : items) {
+            this->EmplaceBack(item);
+        }
+    }
+
+    SmallDynamicArray(SmallDynamicArray<T, N>&& other) noexcept : SmallDynamicArray() {
+        DynamicArray<T>::operator=(std::move(other));
+    }
+
+    SmallDynamicArray(DynamicArray<T>&& other) noexcept : SmallDynamicArray() {
+        DynamicArray<T>::operator=(std::move(other));
+    }
+
+    SmallDynamicArray<T, N>& operator=(const SmallDynamicArray<T, N>& other) {
+        DynamicArray<T>::operator=(other);
+        return *this;
+    }
+
+    SmallDynamicArray<T, N>& operator=(SmallDynamicArray<T, N>&& other) noexcept {
+        DynamicArray<T>::operator=(std::move(other));
+        return *this;
+    }
+
+    //     ,    
+    ~SmallDynamicArray() {
+        this->Clear();
+    }
+};
@@ -0,0 +1,233 @@
+// Sort.h
+#pragma once
+#include "DynamicArray.h"
+#include "Pair.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+//   DynamicArray:
+//   RadixSort(keys)           - LSD radix sort  double  O(n),   
+//   ParallelSort(items, less) -   ,    
+//   SortByKey(items, key)     -    : key   
+//                                ,   (, )
+// threads = 0 -   ,       SORT_MIN_CHUNK 
+
+const int SORT_MIN_CHUNK = 1 << 16;
+
+inline int SortThreadCount(int n, int threads) {
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        int byChunks = n / SORT_MIN_CHUNK;
+        if (threads > byChunks) threads = byChunks;
+    }
+    if (threads > n) threads = n;
+    return threads > 1 ? threads : 1;
+}
+
+// task(t)  t = 0..threads-1;     
+template <typename Task>
+void RunSortTasks(int threads, Task task) {
+    if (threads == 1) {
+        task(0);
+        return;
+    }
+    std::unique_ptr<std::thread[]> workers(new std::thread[threads - 1]);
+    for (int t = 1; t < threads; t++) {
+        workers[t - 1] = std::thread(task, t);
+    }
+    task(0);
+    for (int t = 1; t < threads; t++) {
+        workers[t - 1].join();
+    }
+}
+
+//  double,    :    
+// ,   - . -0.0   0.0, NaN -  
+inline uint64_t OrderedDoubleBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint64_t mask = (uint64_t)(-(int64_t)(bits >> 63)) | 0x8000000000000000ULL;
+    return bits ^ mask;
+}
+
+inline double RadixKey(double value) {
+    return value;
+}
+
+template <typename Payload>
+double RadixKey(const Pair<double, Payload>& record) {
+    return record.key;
+}
+
+//  LSD-   11     (6   64 ).
+//      ,     
+// ,     .     
+//      . ,     
+//  , 
+template <typename Record>
+void RadixSortRecords(Record* items, int n, int threads) {
+    static_assert(std::is_trivially_copyable<Record>::value, "Radix sort moves records with memcpy");
+    const int BITS = 11;
+    const int BUCKETS = 1 << BITS;
+    const int PASSES = (64 + BITS - 1) / BITS;
+    if (n < 2) {
+        return;
+    }
+    threads = SortThreadCount(n, threads);
+
+    DynamicArray<Record> buffer(n);
+    for (int i = 0; i < n; i++) {
+        buffer.EmplaceBack();
+    }
+    int tableSize = threads > 1 ? threads * BUCKETS : PASSES * BUCKETS;
+    DynamicArray<int> counts(tableSize);
+    for (int i = 0; i < tableSize; i++) {
+        counts.Append(0);
+    }
+    Record* source = items;
+    Record* target = buffer.begin();
+    int* table = counts.begin();
+
+    if (threads == 1) {
+        for (int i = 0; i < n; i++) {
+            uint64_t bits = OrderedDoubleBits(RadixKey(items[i]));
+            for (int pass = 0; pass < PASSES; pass++) {
+                table[pass * BUCKETS + ((bits >> (pass * BITS)) & (BUCKETS - 1))]++;
+            }
+        }
+    }
+
+    for (int shift = 0; shift < 64; shift += BITS) {
+        if (threads == 1) {
+            table = counts.begin() + (shift / BITS) * BUCKETS;
+        }
+        else {
+            RunSortTasks(threads, [&](int t) {
+                int* local = table + t * BUCKETS;
+                std::fill(local, local + BUCKETS, 0);
+                int first = (int)((long long)n * t / threads);
+                int last = (int)((long long)n * (t + 1) / threads);
+                for (int i = first; i < last; i++) {
+                    local[(OrderedDoubleBits(RadixKey(source[i])) >> shift) & (BUCKETS - 1)]++;
+                }
+            });
+        }
+
+        // :   ,   -    ()
+        int offset = 0;
+        bool skip = false;
+        for (int digit = 0; digit < BUCKETS && !skip; digit++) {
+            int digitTotal = 0;
+            for (int t = 0; t < threads; t++) {
+                int count = table[t * BUCKETS + digit];
+                table[t * BUCKETS + digit] = offset;
+                offset += count;
+                digitTotal += count;
+            }
+            skip = digitTotal == n;
+        }
+        if (skip) {
+            continue;
+        }
+
+        RunSortTasks(threads, [&](int t) {
+            int* local = table + t * BUCKETS;
+            int first = (int)((long long)n * t / threads);
+            int last = (int)((long long)n * (t + 1) / threads);
+            for (int i = first; i < last; i++) {
+                target[local[(OrderedDoubleBits(RadixKey(source[i])) >> shift) & (BUCKETS - 1)]++] = source[i];
+            }
+        });
+        std::swap(source, target);
+    }
+
+    if (source != items) {
+        std::memcpy(static_cast<void*>(items), static_cast<const void*>(source), sizeof(Record) * n);
+    }
+}
+
+inline void RadixSort(DynamicArray<double>& keys, int threads = 0) {
+    RadixSortRecords(keys.begin(), keys.GetLength(), threads);
+}
+
+//   :   std::stable_sort  
+// ,     ,  -  
+template <typename T, typename Compare>
+void ParallelSort(DynamicArray<T>& items, Compare less, int threads = 0) {
+    int n = items.GetLength();
+    threads = SortThreadCount(n, threads);
+    T* data = items.begin();
+    if (threads == 1) {
+        std::stable_sort(data, data + n, less);
+        return;
+    }
+
+    DynamicArray<int> bounds(threads + 1);
+    for (int t = 0; t <= threads; t++) {
+        bounds.Append((int)((long long)n * t / threads));
+    }
+    RunSortTasks(threads, [&](int t) {
+        std::stable_sort(data + bounds[t], data + bounds[t + 1], less);
+    });
+
+    DynamicArray<T> buffer(items);
+    T* source = data;
+    T* target = buffer.begin();
+    for (int width = 1; width < threads; width *= 2) {
+        int pairs = (threads + 2 * width - 1) / (2 * width);
+        RunSortTasks(pairs, [&](int p) {
+            int lo = bounds[p * 2 * width];
+            int mid = bounds[std::min(p * 2 * width + width, threads)];
+            int hi = bounds[std::min(p * 2 * width + 2 * width, threads)];
+            std::merge(std::make_move_iterator(source + lo), std::make_move_iterator(source + mid),
+                std::make_move_iterator(source + mid), std::make_move_iterator(source + hi), target + lo, less);
+        });
+        std::swap(source, target);
+    }
+    if (source != data) {
+        std::move(source, source + n, data);
+    }
+}
+
+template <typename Key>
+struct KeyIndexLess {
+    bool operator()(const Pair<Key, int>& a, const Pair<Key, int>& b) const {
+        return a.key < b.key;
+    }
+};
+
+template <typename Key>
+void SortKeyIndex(DynamicArray<Pair<Key, int>>& records, int threads, std::false_type) {
+    ParallelSort(records, KeyIndexLess<Key>(), threads);
+}
+
+inline void SortKeyIndex(DynamicArray<Pair<double, int>>& records, int threads, std::true_type) {
+    RadixSortRecords(records.begin(), records.GetLength(), threads);
+}
+
+//     key(item);  double  
+template <typename T, typename KeyFunc>
+void SortByKey(DynamicArray<T>& items, KeyFunc key, int threads = 0) {
+    typedef typename std::decay<decltype(key(items.GetElem(0)))>::type Key;
+    int n = items.GetLength();
+    if (n < 2) {
+        return;
+    }
+
+    DynamicArray<Pair<Key, int>> records(n);
+    for (int i = 0; i < n; i++) {
+        records.EmplaceBack(key(items[i]), i);
+    }
+    SortKeyIndex(records, threads, std::is_same<Key, double>());
+
+    DynamicArray<T> sorted(n);
+    for (const Pair<Key, int>& record : records) {
+        sorted.EmplaceBack(std::move(items[record.value]));
+    }
+    items = std::move(sorted);
+}
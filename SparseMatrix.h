@@ -1,8 +1,10 @@
 #pragma once
 #include "IDictionary.h"
+#include "IOrderedDictionary.h"
 #include "DynamicArray.h"
 #include "Pair.h"
 #include <stdexcept>
+#include <climits>
 
 template <typename T>
 class SparseMatrix {
@@ -30,16 +32,65 @@ public:
         }
     }
 
+    //    ((row, col), value)    ,    set:
+    //           
+    // elements ( ),   
+    void setBatch(ArrayView<const Pair<Pair<int, int>, T>> elements) {
+        int runStart = 0;
+        for (int i = 0; i < elements.GetLength(); i++) {
+            const Pair<Pair<int, int>, T>& element = elements.GetElem(i);
+            int row = element.key.key;
+            int col = element.key.value;
+            if (row < 0 || row > rows || col < 0 || col > cols) {
+                throw std::out_of_range("Index out of range in SparseMatrix");
+            }
+
+            if (element.value == T()) {
+                dict->insertBatch(elements.Slice(runStart, i - runStart));
+                dict->remove(element.key);
+                runStart = i + 1;
+            }
+        }
+        dict->insertBatch(elements.Slice(runStart, elements.GetLength() - runStart));
+    }
+
     T get(int row, int col) const {
         if (row < 0 || row > rows || col < 0 || col > cols) {
             throw std::out_of_range("Index out of range in SparseMatrix");
         }
         Pair<int, int> key(row, col);
 
-        if (dict->exist(key)) {
-            return dict->get(key);
+        //   :       ()
+        //   (ShardedHashTable)
+        T value = T(); // 0  
+        dict->tryGet(key, value);
+        return value;
+    }
+
+    //    (, )   .
+    //    -    [(row, INT_MIN), (row + 1, INT_MIN))
+    //  O(log n + k),  -    
+    void getRow(int row, DynamicArray<Pair<int, T>>& arr) const {
+        if (row < 0 || row > rows) {
+            throw std::out_of_range("Index out of range in SparseMatrix");
+        }
+
+        const IOrderedDictionary<Pair<int, int>, T>* ordered =
+            dynamic_cast<const IOrderedDictionary<Pair<int, int>, T>*>(dict);
+        if (ordered) {
+            ordered->forEachInRange(Pair<int, int>(row, INT_MIN), Pair<int, int>(row + 1, INT_MIN),
+                [&arr](const Pair<Pair<int, int>, T>& element) {
+                    arr.Append(Pair<int, T>(element.key.value, element.value));
+                });
+            return;
+        }
+
+        for (int col = 0; col <= cols; col++) {
+            T value;
+            if (dict->tryGet(Pair<int, int>(row, col), value)) {
+                arr.Append(Pair<int, T>(col, value));
+            }
         }
-        return T(); // 0  
     }
 
     int getNumRows() const { return rows; }
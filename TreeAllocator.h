@@ -0,0 +1,116 @@
+// TreeAllocator.h
+#pragma once
+
+#include <new>
+#include <utility>
+#include <type_traits>
+
+//     BalanceBinaryTree.
+//   (    Node):
+//   Node* create(args...)   -  
+//   void destroy(Node*)     -  
+//   void releaseAll()       -    ,   
+//   RELEASES_ALL            -    releaseAll   
+//   THREAD_SAFE             -         
+
+//   -  new/delete
+template <typename Node>
+struct NewDeleteAllocator {
+    static const bool RELEASES_ALL = false;
+    static const bool THREAD_SAFE = true;
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node* node) {
+        delete node;
+    }
+
+    void releaseAll() {}
+};
+
+//  :       (slab),  
+//       .   
+// ,     O( )   .
+//      :     
+template <typename Node>
+class NodePool {
+private:
+    //       
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    //  64   ,    16 
+    static const int SLAB_NODES = 65536 / sizeof(Slot) > 16 ? (int)(65536 / sizeof(Slot)) : 16;
+
+    struct Slab {
+        Slab* next;
+        Slot slots[SLAB_NODES];
+    };
+
+    Slab* slabs;     //  ,  - 
+    int used;        //      
+    Slot* freeList;  //  
+
+public:
+    static const bool RELEASES_ALL = std::is_trivially_destructible<Node>::value;
+    static const bool THREAD_SAFE = false;
+
+    NodePool() : slabs(nullptr), used(0), freeList(nullptr) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        releaseAll();
+    }
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        Slot* slot;
+        if (freeList) {
+            slot = freeList;
+            freeList = freeList->next;
+        }
+        else {
+            if (!slabs || used == SLAB_NODES) {
+                Slab* slab = new Slab;
+                slab->next = slabs;
+                slabs = slab;
+                used = 0;
+            }
+            slot = &slabs->slots[used++];
+        }
+
+        try {
+            return new (slot->storage) Node(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            slot->next = freeList;
+            freeList = slot;
+            throw;
+        }
+    }
+
+    void destroy(Node* node) {
+        node->~Node();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    //   ;    
+    void releaseAll() {
+        while (slabs) {
+            Slab* next = slabs->next;
+            delete slabs;
+            slabs = next;
+        }
+        used = 0;
+        freeList = nullptr;
+    }
+};
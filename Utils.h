@@ -2,13 +2,13 @@
 #pragma once
 #include <iostream>
 #include "IDictionary.h"
-#include "DynamicArray.h"
+#include "SmallDynamicArray.h"
 #include "Pair.h"
 
 //   (K, V)   
 template <typename K, typename V>
 void PrintDictionary(const IDictionary<K, V>* dict) {
-    DynamicArray<Pair<K, V>> pairs;
+    SmallDynamicArray<Pair<K, V>, 16> pairs;
     dict->getAllPairs(pairs);
 
     for (int i = 0; i < pairs.GetLength(); i++) {
@@ -19,7 +19,8 @@ void PrintDictionary(const IDictionary<K, V>* dict) {
 
 //    Pair<double, double>   int
 inline void PrintDictionary(const IDictionary<Pair<double, double>, int>* dict) {
-    DynamicArray<Pair<Pair<double, double>, int>> pairs;
+    //      -     
+    SmallDynamicArray<Pair<Pair<double, double>, int>, 16> pairs;
     dict->getAllPairs(pairs);
 
     for (int i = 0; i < pairs.GetLength(); i++) {